@@ -0,0 +1,62 @@
+// Global operator new / delete kancaları.
+// Bu dosya yalnızca ölçüm yapan yürütülebilirlere eklenir (kütüphaneye değil).
+// Her bloğun önüne boyut başlığı yazılır; delete boyutu buradan okur.
+
+#include "AllocationTracker.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+constexpr std::size_t kHeader = alignof(std::max_align_t) > sizeof(std::size_t)
+                                ? alignof(std::max_align_t) : sizeof(std::size_t);
+
+struct HooksInstaller {
+    HooksInstaller() { AllocationTracker::markInstalled(); }
+} installer;
+
+void* trackedAlloc(std::size_t size) {
+    void* raw = std::malloc(size + kHeader);
+    if (!raw) return nullptr;
+    *static_cast<std::size_t*>(raw) = size;
+    AllocationTracker::onAlloc(size);
+    return static_cast<char*>(raw) + kHeader;
+}
+
+void trackedFree(void* p) {
+    if (!p) return;
+    void* raw = static_cast<char*>(p) - kHeader;
+    AllocationTracker::onFree(*static_cast<std::size_t*>(raw));
+    std::free(raw);
+}
+
+void* allocOrThrow(std::size_t size) {
+    if (size == 0) size = 1;
+    for (;;) {
+        if (void* p = trackedAlloc(size)) return p;
+        std::new_handler h = std::get_new_handler();
+        if (!h) throw std::bad_alloc();
+        h();
+    }
+}
+
+}
+
+void* operator new(std::size_t size) { return allocOrThrow(size); }
+void* operator new[](std::size_t size) { return allocOrThrow(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return allocOrThrow(size); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return allocOrThrow(size); } catch (...) { return nullptr; }
+}
+
+void operator delete(void* p) noexcept { trackedFree(p); }
+void operator delete[](void* p) noexcept { trackedFree(p); }
+void operator delete(void* p, std::size_t) noexcept { trackedFree(p); }
+void operator delete[](void* p, std::size_t) noexcept { trackedFree(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { trackedFree(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { trackedFree(p); }
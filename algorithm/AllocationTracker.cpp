@@ -0,0 +1,52 @@
+#include "AllocationTracker.h"
+
+#include <atomic>
+
+namespace {
+
+struct ThreadCounters {
+    bool active = false;
+    long long live = 0;
+    AllocationStats stats;
+};
+
+// Önemsiz (trivial) tür: thread_local başlatma sırasında ayırma yapmaz
+thread_local ThreadCounters tls;
+std::atomic<bool> hooksInstalled{false};
+
+}
+
+bool AllocationTracker::installed() {
+    return hooksInstalled.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::markInstalled() {
+    hooksInstalled.store(true, std::memory_order_relaxed);
+}
+
+void AllocationTracker::begin() {
+    tls.stats = AllocationStats();
+    tls.live = 0;
+    tls.active = true;
+}
+
+AllocationStats AllocationTracker::end() {
+    tls.active = false;
+    return tls.stats;
+}
+
+void AllocationTracker::onAlloc(std::size_t bytes) {
+    ThreadCounters& t = tls;
+    if (!t.active) return;
+    t.stats.allocations++;
+    t.stats.bytesAllocated += (long long)bytes;
+    t.live += (long long)bytes;
+    if (t.live > t.stats.peakLiveBytes) t.stats.peakLiveBytes = t.live;
+}
+
+void AllocationTracker::onFree(std::size_t bytes) {
+    ThreadCounters& t = tls;
+    if (!t.active) return;
+    t.stats.frees++;
+    t.live -= (long long)bytes;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+
+struct AllocationStats {
+    long long allocations = 0;     // operator new çağrısı
+    long long frees = 0;           // operator delete çağrısı
+    long long bytesAllocated = 0;  // toplam istenen bayt
+    long long peakLiveBytes = 0;   // ölçüm başından itibaren en yüksek canlı bayt
+};
+
+// İş parçacığı başına bellek ayırma sayaçları.
+// Sayaçlar yalnızca global new/delete kancaları (AllocationHooks.cpp)
+// yürütülebilire bağlandığında dolar; aksi halde installed() false döner.
+// Ölçüm çağıran iş parçacığıyla sınırlıdır; yardımcı iş parçacıklarının
+// ayırmaları ve Qt'nin malloc ile yaptığı ayırmalar (QString verisi) sayılmaz.
+class AllocationTracker {
+public:
+    static bool installed();
+
+    // Bu iş parçacığında ölçümü başlat / bitir (iç içe kullanılmaz)
+    static void begin();
+    static AllocationStats end();
+
+    // Kancalar tarafından çağrılır
+    static void markInstalled();
+    static void onAlloc(std::size_t bytes);
+    static void onFree(std::size_t bytes);
+};
+
+// Kapsam boyunca ayırmaları sayar
+class ScopedAllocationTracking {
+public:
+    ScopedAllocationTracking() { AllocationTracker::begin(); }
+    ~ScopedAllocationTracking() { if (!done) AllocationTracker::end(); }
+
+    AllocationStats stop() {
+        done = true;
+        return AllocationTracker::end();
+    }
+
+    ScopedAllocationTracking(const ScopedAllocationTracking&) = delete;
+    ScopedAllocationTracking& operator=(const ScopedAllocationTracking&) = delete;
+
+private:
+    bool done = false;
+};
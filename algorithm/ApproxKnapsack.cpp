@@ -0,0 +1,266 @@
+#include "ApproxKnapsack.h"
+
+#include <algorithm>
+#include <climits>
+#include <numeric>
+
+void ApproxKnapsack::init(const int* weights, const int* values, int n, int cap,
+                          const ApproxKnapsackOptions& options) {
+    w = weights;
+    v = values;
+    capacity = cap;
+    opt = options;
+    opt.epsilon = std::min(std::max(opt.epsilon, 1e-4), 1.0);
+
+    live.resize(std::max(0, n));
+    std::iota(live.begin(), live.end(), 0);
+
+    worstRatio = 1.0;
+    worstEpsilon = 0.0;
+    exactCount = 0;
+    scaledCount = 0;
+    peakBytes = 0;
+}
+
+long long ApproxKnapsack::solveNext(std::vector<int>& picked) {
+    picked.clear();
+    if (live.empty() || capacity < 0) return 0;
+
+    // Adaylar: rafa sığan ve satışı pozitif ürünler; hacmi 0 olanlar bedava
+    std::vector<int> cand;
+    cand.reserve(live.size());
+    for (int i : live) {
+        if (v[i] <= 0 || w[i] < 0 || w[i] > capacity) continue;
+        if (w[i] == 0) picked.push_back(i);
+        else cand.push_back(i);
+    }
+    if (profile) profile->count(PlacementCounter::ItemsScanned, (long long)live.size());
+
+    if (!solveExact(cand, picked)) solveScaled(cand, picked);
+
+    long long value = 0;
+    {
+        ScopedPhase phase(profile, PlacementPhase::Compaction);
+        std::vector<int> sorted = picked;
+        std::sort(sorted.begin(), sorted.end());
+        size_t k = 0;
+        auto keep = live.begin();
+        for (int i : live) {
+            while (k < sorted.size() && sorted[k] < i) ++k;
+            if (k < sorted.size() && sorted[k] == i) { value += v[i]; continue; }
+            *keep++ = i;
+        }
+        live.erase(keep, live.end());
+    }
+    return value;
+}
+
+// Hacimlerin ortak böleniyle kapasite küçülür; tablo sığıyorsa kesin çöz
+bool ApproxKnapsack::solveExact(const std::vector<int>& cand, std::vector<int>& picked) {
+    if (cand.empty()) {
+        ++exactCount;
+        return true;
+    }
+
+    int g = 0;
+    for (int i : cand) g = std::gcd(g, w[i]);
+
+    const int reducedCap = capacity / g;
+    const long long cells = (long long)cand.size() * (reducedCap + 1);
+    const long long bytes = cells / 8 + (long long)(reducedCap + 1) * (long long)sizeof(int);
+    if (cells > opt.exactCellLimit || bytes > opt.memoryBudgetBytes) return false;
+
+    const int k = (int)cand.size();
+    reducedW.resize(k);
+    reducedV.resize(k);
+    for (int r = 0; r < k; ++r) {
+        reducedW[r] = w[cand[r]] / g;
+        reducedV[r] = v[cand[r]];
+    }
+
+    std::vector<int> local;
+    {
+        ScopedPhase phase(profile, PlacementPhase::DPFill);
+        exact.solve(reducedW.data(), reducedV.data(), k, reducedCap, local);
+    }
+    for (int r : local) picked.push_back(cand[r]);
+
+    if (profile) profile->count(PlacementCounter::CellsEvaluated, cells);
+    peakBytes = std::max(peakBytes, bytes);
+    ++exactCount;
+    return true;
+}
+
+void ApproxKnapsack::solveScaled(const std::vector<int>& cand, std::vector<int>& picked) {
+    ++scaledCount;
+
+    // Satış/hacim oranına göre azalan
+    std::vector<int> order = cand;
+    {
+        ScopedPhase phase(profile, PlacementPhase::Sort);
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            const long long l = (long long)v[a] * w[b];
+            const long long r = (long long)v[b] * w[a];
+            if (l != r) return l > r;
+            return a < b;
+        });
+    }
+
+    // Alt sınır: açgözlü ya da en iyi tek ürün (LB >= OPT / 2)
+    std::vector<int> greedyPick;
+    long long greedyValue = 0;
+    int bestSingle = -1;
+    {
+        long long rem = capacity;
+        for (int i : order) {
+            if (w[i] <= rem) {
+                rem -= w[i];
+                greedyValue += v[i];
+                greedyPick.push_back(i);
+            }
+            if (bestSingle < 0 || v[i] > v[bestSingle]) bestSingle = i;
+        }
+    }
+    const long long lb = std::max(greedyValue, bestSingle >= 0 ? (long long)v[bestSingle] : 0LL);
+    if (lb <= 0) return;
+
+    // Üst sınır (LP gevşetmesi, UB <= 2 * LB): ölçekli tablo boyu UB / K ile sınırlanır
+    double ub = 0.0;
+    {
+        long long rem = capacity;
+        for (int i : order) {
+            if (w[i] <= rem) { rem -= w[i]; ub += v[i]; continue; }
+            ub += (double)v[i] * rem / w[i];
+            break;
+        }
+        ub = std::min(ub, 2.0 * (double)lb);
+    }
+
+    // Büyük ürünler: (ölçekli değer, hacim, indeks); bütçeye sığana dek ε büyür
+    struct Large { int q; int weight; int idx; };
+    std::vector<Large> large;
+    double eps = opt.epsilon / 2;
+    int qmax = 0;
+    long long bytes = 0;
+    for (;;) {
+        const double scale = eps * eps * (double)lb;
+        const double threshold = eps * (double)lb;
+        qmax = (int)std::min<double>(ub / scale, INT_MAX / 2);
+
+        large.clear();
+        for (int i : order) {
+            if (v[i] <= threshold) continue;
+            const int q = (int)std::min<double>(v[i] / scale, qmax);
+            large.push_back({q, w[i], i});
+        }
+
+        // Aynı ölçekli değerden bir çözümde en fazla qmax / q ürün olur; en hafifleri yeter
+        std::sort(large.begin(), large.end(), [&](const Large& a, const Large& b) {
+            if (a.q != b.q) return a.q < b.q;
+            if (a.weight != b.weight) return a.weight < b.weight;
+            return v[a.idx] > v[b.idx];
+        });
+        size_t kept = 0;
+        for (size_t s = 0; s < large.size();) {
+            size_t e = s;
+            while (e < large.size() && large[e].q == large[s].q) ++e;
+            const size_t limit = std::max(1, qmax / std::max(1, large[s].q));
+            for (size_t t = s; t < e && t - s < limit; ++t) large[kept++] = large[t];
+            s = e;
+        }
+        large.resize(kept);
+
+        bytes = (long long)large.size() * ((qmax + 64) / 64) * 8
+                + (long long)(qmax + 1) * 2 * (long long)sizeof(long long);
+        if (bytes <= opt.memoryBudgetBytes || eps >= 0.5) break;
+        eps = std::min(0.5, eps * 1.25);
+    }
+    peakBytes = std::max(peakBytes, bytes);
+    worstEpsilon = std::max(worstEpsilon, 2 * eps);
+    // LB çözümü de aday olduğundan oran hiçbir zaman 1/2'nin altına düşmez
+    worstRatio = std::min(worstRatio, std::max(0.5, 1.0 - 2 * eps));
+
+    // Ölçekli değer -> en küçük hacim (ve o kümenin gerçek satışı)
+    const int L = (int)large.size();
+    const long long INF = LLONG_MAX / 4;
+    std::vector<long long> minW(qmax + 1, INF);
+    std::vector<long long> realP(qmax + 1, 0);
+    minW[0] = 0;
+    {
+        ScopedPhase phase(profile, PlacementPhase::DPFill);
+        take.reset(L, qmax + 1);
+        int reach = 0;   // şimdiye dek ulaşılabilen en büyük ölçekli değer
+        for (int r = 0; r < L; ++r) {
+            const int qr = large[r].q;
+            const long long wr = large[r].weight;
+            const long long pr = v[large[r].idx];
+            uint64_t* bits = take.row(r);
+            reach = std::min(qmax, reach + qr);
+            for (int q = reach; q >= qr; --q) {
+                const long long base = minW[q - qr];
+                if (base == INF) continue;
+                const long long nw = base + wr;
+                if (nw > capacity) continue;
+                const long long np = realP[q - qr] + pr;
+                if (nw < minW[q] || (nw == minW[q] && np > realP[q])) {
+                    minW[q] = nw;
+                    realP[q] = np;
+                    bits[q >> 6] |= 1ULL << (q & 63);
+                }
+            }
+        }
+    }
+    if (profile) profile->count(PlacementCounter::CellsEvaluated, (long long)L * (qmax + 1));
+
+    // Küçük ürünlerin oran sıralı önek toplamları
+    std::vector<int> small;
+    const double smallThreshold = eps * (double)lb;
+    for (int i : order)
+        if (v[i] <= smallThreshold) small.push_back(i);
+    std::vector<long long> sw(small.size() + 1, 0), sp(small.size() + 1, 0);
+    for (size_t t = 0; t < small.size(); ++t) {
+        sw[t + 1] = sw[t] + w[small[t]];
+        sp[t + 1] = sp[t] + v[small[t]];
+    }
+
+    int bestQ = 0;
+    long long bestValue = -1;
+    for (int q = 0; q <= qmax; ++q) {
+        if (minW[q] > capacity) continue;
+        const long long rem = capacity - minW[q];
+        const int t = (int)(std::upper_bound(sw.begin(), sw.end(), rem) - sw.begin()) - 1;
+        const long long value = realP[q] + sp[t];
+        if (value > bestValue) { bestValue = value; bestQ = q; }
+    }
+
+    std::vector<int> scaledPick;
+    long long scaledValue = 0;
+    {
+        ScopedPhase phase(profile, PlacementPhase::Traceback);
+        long long used = 0;
+        int q = bestQ;
+        for (int r = L - 1; r >= 0 && q > 0; --r) {
+            if (take.test(r, q)) {
+                scaledPick.push_back(large[r].idx);
+                scaledValue += v[large[r].idx];
+                used += large[r].weight;
+                q -= large[r].q;
+            }
+        }
+        // Küçükler: önekten sonra sığanlar da eklenir (yalnızca iyileştirir)
+        for (int i : small) {
+            if (used + w[i] > capacity) continue;
+            used += w[i];
+            scaledValue += v[i];
+            scaledPick.push_back(i);
+        }
+    }
+
+    if (scaledValue >= greedyValue && scaledValue >= v[bestSingle]) {
+        picked.insert(picked.end(), scaledPick.begin(), scaledPick.end());
+    } else if (greedyValue >= v[bestSingle]) {
+        picked.insert(picked.end(), greedyPick.begin(), greedyPick.end());
+    } else {
+        picked.push_back(bestSingle);
+    }
+}
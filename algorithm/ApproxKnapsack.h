@@ -0,0 +1,70 @@
+#pragma once
+#include <vector>
+
+#include "KnapsackDP.h"
+#include "PlacementProfile.h"
+
+struct ApproxKnapsackOptions {
+    double epsilon = 0.05;                       // raf başına kayıp en fazla ε * optimum
+    long long memoryBudgetBytes = 64LL << 20;    // DP tablosu + karar bitleri üst sınırı
+    long long exactCellLimit = 1LL << 24;        // altındaysa (GCD indirgemeli) kesin DP
+};
+
+// Büyük kapasiteler için knapsack (cm³ mertebesinde raflar).
+// Her raf için önce hacimlerin GCD'si ile kapasite küçültülür; indirgenmiş
+// tablo exactCellLimit ve bellek bütçesine sığıyorsa kesin DP çözülür.
+// Sığmıyorsa Ibarra–Kim FPTAS:
+// - LB: oran sıralı açgözlü ve en iyi tek ürünün büyüğü (LB >= OPT / 2)
+// - Satışı ε'·LB'den büyük ürünler "büyük": satışlar K = ε'²·LB ile ölçeklenir,
+//   DP ölçekli değer -> en küçük hacim üzerinden, boyut O(1/ε'²), C'den bağımsız
+// - Küçük ürünler her DP durumunun kalan kapasitesine oran sırasıyla eklenir
+// ε' = ε / 2 ile değer >= (1 - ε) * OPT. Tablo bütçeyi aşarsa ε büyütülür;
+// gerçekten sağlanan oran (en az 1/2) guaranteedRatio() ile raporlanır.
+class ApproxKnapsack {
+public:
+    // weights/values: n elemanlı bitişik diziler (nesne yaşadığı sürece geçerli)
+    void init(const int* weights, const int* values, int n, int capacity,
+              const ApproxKnapsackOptions& options);
+
+    // Kalan ürünler üzerinde bir raf çöz; seçilenler tüketilir.
+    // picked: orijinal indeksler
+    long long solveNext(std::vector<int>& picked);
+
+    int remainingCount() const { return (int)live.size(); }
+
+    // Şimdiye dek çözülen raflar için garanti edilen en kötü oran (kesin: 1)
+    double guaranteedRatio() const { return worstRatio; }
+    // Bütçe nedeniyle büyütülmüş olabilecek en büyük ε
+    double effectiveEpsilon() const { return worstEpsilon; }
+
+    int exactShelves() const { return exactCount; }
+    int scaledShelves() const { return scaledCount; }
+    long long peakTableBytes() const { return peakBytes; }
+
+    // Faz süreleri ve sayaçlar buraya eklenir (nullptr: ölçüm yok)
+    void setProfile(PlacementProfile* p) { profile = p; }
+
+private:
+    bool solveExact(const std::vector<int>& cand, std::vector<int>& picked);
+    void solveScaled(const std::vector<int>& cand, std::vector<int>& picked);
+
+    PlacementProfile* profile = nullptr;
+    ApproxKnapsackOptions opt;
+
+    const int* w = nullptr;
+    const int* v = nullptr;
+    int capacity = 0;
+
+    std::vector<int> live;          // henüz rafa girmemiş ürünler
+
+    double worstRatio = 1.0;
+    double worstEpsilon = 0.0;
+    int exactCount = 0;
+    int scaledCount = 0;
+    long long peakBytes = 0;
+
+    KnapsackDP exact;
+    DecisionBits take;
+    std::vector<int> reducedW;
+    std::vector<int> reducedV;
+};
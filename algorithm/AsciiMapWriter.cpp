@@ -0,0 +1,149 @@
+#include "AsciiMapWriter.h"
+
+#include <QFile>
+#include <algorithm>
+
+static const QString kTitle = QStringLiteral("=========== ASCII DEPO HARITASI ===========\n");
+
+static int decimalLength(long long x) {
+    int len = 1;
+    if (x < 0) { ++len; x = -x; }
+    while (x >= 10) { x /= 10; ++len; }
+    return len;
+}
+
+// Rakamlar yığındaki tampona yazılır; geçici QString yok
+static void appendNumber(QString& buf, int x) {
+    QChar digits[12];
+    int pos = 12;
+    unsigned long long v = x < 0 ? -(long long)x : x;
+    do {
+        digits[--pos] = QChar(char16_t(u'0' + v % 10));
+        v /= 10;
+    } while (v);
+    if (x < 0) digits[--pos] = QChar(u'-');
+    buf.append(digits + pos, 12 - pos);
+}
+
+// -------------------- FileMapSink
+struct FileMapSink::Impl {
+    QFile file;
+};
+
+FileMapSink::FileMapSink(const QString& path) : d(std::make_unique<Impl>()) {
+    d->file.setFileName(path);
+    d->file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+}
+
+FileMapSink::~FileMapSink() = default;
+
+bool FileMapSink::isOpen() const { return d->file.isOpen(); }
+QString FileMapSink::errorString() const { return d->file.errorString(); }
+
+bool FileMapSink::write(QStringView chunk) {
+    if (!d->file.isOpen()) return false;
+    const QByteArray bytes = chunk.toUtf8();
+    return d->file.write(bytes) == bytes.size();
+}
+
+// -------------------- AsciiMapWriter
+AsciiMapWriter::AsciiMapWriter(const ShelfLayout& l, const ProductCatalog& c)
+    : layout(l), catalog(c) {}
+
+qsizetype AsciiMapWriter::sizeHint(int firstShelf, int lastShelf, bool withHeader) const {
+    // Sabit parçaların uzunlukları yazım biçimiyle aynı olmalı
+    static const int shelfFixed = (int)QStringLiteral("Raf  | Kapasite: | Kullanilan: | Bos:\n").size();
+    static const int itemFixed  = (int)QStringLiteral("  -  (Satis:, Hacim:)\n").size();
+
+    qsizetype total = withHeader ? kTitle.size() : 0;
+    for (int s = firstShelf; s < lastShelf; ++s) {
+        const int cap = layout.capacity[s];
+        const int used = layout.used[s];
+        total += shelfFixed + decimalLength(s + 1) + decimalLength(cap)
+               + decimalLength(used) + decimalLength((long long)cap - used);
+        total += kBarLen + 3;   // "[...]\n"
+        for (int idx : layout.shelf(s)) {
+            total += itemFixed + catalog.name(idx).size()
+                   + decimalLength(catalog.sales(idx)) + decimalLength(catalog.volume(idx));
+        }
+        total += 1;             // raf sonu boş satır
+    }
+    return total;
+}
+
+bool AsciiMapWriter::write(AsciiMapSink& sink, int firstShelf, int lastShelf, bool withHeader) const {
+    QString buf;
+    buf.reserve(kFlushChars + 1024);
+
+    auto flush = [&]() {
+        if (buf.isEmpty()) return true;
+        const bool ok = sink.write(buf);
+        buf.resize(0);   // kapasite korunur
+        return ok;
+    };
+
+    if (withHeader) buf.append(kTitle);
+
+    for (int i = firstShelf; i < lastShelf; ++i) {
+        const Shelf s = layout.shelf(i);
+
+        buf.append(u"Raf ");            appendNumber(buf, i + 1);
+        buf.append(u" | Kapasite:");    appendNumber(buf, s.capacity);
+        buf.append(u" | Kullanilan:");  appendNumber(buf, s.used);
+        buf.append(u" | Bos:");         appendNumber(buf, s.capacity - s.used);
+        buf.append(u'\n');
+
+        // Çubuk tek seferde: "[###....]\n"
+        const int filled = (s.capacity == 0) ? 0 : (int)((double)s.used / s.capacity * kBarLen);
+        const int hashes = std::max(0, std::min(filled, kBarLen));
+        buf.append(u'[');
+        const qsizetype barAt = buf.size();
+        buf.resize(barAt + hashes, u'#');
+        buf.resize(barAt + kBarLen, u'.');
+        buf.append(u"]\n");
+
+        for (int idx : s) {
+            buf.append(u"  - ");
+            buf.append(catalog.name(idx));
+            buf.append(u" (Satis:");  appendNumber(buf, catalog.sales(idx));
+            buf.append(u", Hacim:"); appendNumber(buf, catalog.volume(idx));
+            buf.append(u")\n");
+
+            if (buf.size() >= kFlushChars && !flush()) return false;
+        }
+        buf.append(u'\n');
+
+        if (buf.size() >= kFlushChars && !flush()) return false;
+    }
+    return flush();
+}
+
+std::vector<int> AsciiMapWriter::paginate(int maxLines) const {
+    const int m = layout.shelfCount();
+    std::vector<int> starts = {0};
+
+    int lines = 1;   // başlık
+    for (int s = 0; s < m; ++s) {
+        const int l = shelfLines(s);
+        if (s > starts.back() && lines + l > maxLines) {
+            starts.push_back(s);
+            lines = 0;
+        }
+        lines += l;
+    }
+    starts.push_back(m);
+    return starts;
+}
+
+QString AsciiMapWriter::page(const std::vector<int>& pageStarts, int pageIndex) const {
+    QString out;
+    if (pageIndex < 0 || pageIndex + 1 >= (int)pageStarts.size()) return out;
+
+    const int first = pageStarts[pageIndex];
+    const int last  = pageStarts[pageIndex + 1];
+    out.reserve(sizeHint(first, last, pageIndex == 0));
+
+    StringMapSink sink(out);
+    write(sink, first, last, pageIndex == 0);
+    return out;
+}
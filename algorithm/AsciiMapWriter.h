@@ -0,0 +1,73 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include <QString>
+#include <QStringView>
+
+#include "../model/ShelfLayout.h"
+#include "../model/ProductCatalog.h"
+
+// ASCII haritanın yazıldığı hedef. write() false dönerse yazım durur.
+class AsciiMapSink {
+public:
+    virtual ~AsciiMapSink() = default;
+    virtual bool write(QStringView chunk) = 0;
+};
+
+// Bellekteki QString'e yazar
+class StringMapSink : public AsciiMapSink {
+public:
+    explicit StringMapSink(QString& target) : out(target) {}
+    bool write(QStringView chunk) override {
+        out.append(chunk);
+        return true;
+    }
+
+private:
+    QString& out;
+};
+
+// Dosyaya UTF-8 olarak yazar (tüm harita bellekte tutulmaz)
+class FileMapSink : public AsciiMapSink {
+public:
+    explicit FileMapSink(const QString& path);
+    ~FileMapSink() override;
+
+    FileMapSink(const FileMapSink&) = delete;
+    FileMapSink& operator=(const FileMapSink&) = delete;
+
+    bool isOpen() const;
+    QString errorString() const;
+    bool write(QStringView chunk) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> d;
+};
+
+// Yerleşimi raf raf, sabit boyutlu tampon üzerinden sink'e aktarır.
+// Doluluk çubuğu toplu doldurulur; çıktı buildAsciiMap ile birebir aynıdır.
+class AsciiMapWriter {
+public:
+    static constexpr int kBarLen = 30;
+    static constexpr int kFlushChars = 1 << 16;
+
+    AsciiMapWriter(const ShelfLayout& layout, const ProductCatalog& catalog);
+
+    // [firstShelf, lastShelf) aralığının tam karakter uzunluğu (başlık dahilse onunla)
+    qsizetype sizeHint(int firstShelf, int lastShelf, bool withHeader = true) const;
+
+    bool write(AsciiMapSink& sink, int firstShelf, int lastShelf, bool withHeader = true) const;
+    bool writeAll(AsciiMapSink& sink) const { return write(sink, 0, layout.shelfCount()); }
+
+    // Sayfa başlangıç rafları: her sayfa en fazla maxLines satır (tek raf
+    // daha uzunsa kendi sayfasını alır). Son eleman shelfCount().
+    std::vector<int> paginate(int maxLines) const;
+    QString page(const std::vector<int>& pageStarts, int pageIndex) const;
+
+private:
+    int shelfLines(int s) const { return 3 + layout.itemCount(s); }
+
+    const ShelfLayout& layout;
+    const ProductCatalog& catalog;
+};
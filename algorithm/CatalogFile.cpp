@@ -0,0 +1,421 @@
+#include "CatalogFile.h"
+#include "PlacementProfile.h"
+
+#include <QFile>
+#include <QSaveFile>
+#include <QTemporaryFile>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static_assert(sizeof(int) == 4, "sütunlar int32 olarak yazılır");
+static_assert(sizeof(QChar) == 2, "isimler UTF-16 olarak yazılır");
+
+namespace {
+
+constexpr char kMagic[8] = {'W', 'H', 'C', 'A', 'T', 'L', 'O', 'G'};
+constexpr uint32_t kByteOrderMark = 0x01020304u;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;     // yazan makinede 0x01020304
+    int64_t count;
+    int64_t nameChars;
+    int64_t salesAt;        // bölüm ofsetleri (dosya başından bayt)
+    int64_t volumeAt;
+    int64_t offsetsAt;
+    int64_t namesAt;
+};
+static_assert(sizeof(FileHeader) == 64, "başlık 64 bayt");
+
+int64_t align8(int64_t x) { return (x + 7) & ~int64_t(7); }
+
+// Bölüm yerleşimi yalnızca ürün sayısı ve isim uzunluğuna bağlı
+FileHeader makeHeader(int64_t count, int64_t nameChars) {
+    FileHeader h;
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.version   = CatalogFile::kVersion;
+    h.byteOrder = kByteOrderMark;
+    h.count     = count;
+    h.nameChars = nameChars;
+    h.salesAt   = (int64_t)sizeof(FileHeader);
+    h.volumeAt  = align8(h.salesAt + count * 4);
+    h.offsetsAt = align8(h.volumeAt + count * 4);
+    h.namesAt   = h.offsetsAt + (count + 1) * 8;
+    return h;
+}
+
+bool fail(QString* error, const QString& msg) {
+    if (error) *error = msg;
+    return false;
+}
+
+// Sabit tamponlu sıralı yazıcı; ilk başarısız yazmadan sonra hiçbir şey yazmaz
+class ChunkWriter {
+public:
+    ChunkWriter(QIODevice& device, int capacity) : dev(device), cap((size_t)capacity) { buf.reserve(cap); }
+
+    void put(const void* data, size_t bytes) {
+        const char* p = static_cast<const char*>(data);
+        // Büyük bitişik bloklar tampona kopyalanmadan yazılır
+        if (bytes >= cap) {
+            flush();
+            if (ok) ok = dev.write(p, (qint64)bytes) == (qint64)bytes;
+            return;
+        }
+        if (buf.size() + bytes > cap) flush();
+        buf.insert(buf.end(), p, p + bytes);
+    }
+
+    void padTo8(int64_t written) {
+        static const char zeros[8] = {};
+        put(zeros, (size_t)(align8(written) - written));
+    }
+
+    bool flush() {
+        if (!buf.empty() && ok) ok = dev.write(buf.data(), (qint64)buf.size()) == (qint64)buf.size();
+        buf.clear();
+        return ok;
+    }
+
+private:
+    QIODevice& dev;
+    size_t cap;
+    std::vector<char> buf;
+    bool ok = true;
+};
+
+// -------------------- CSV alanları
+bool parseInt(const char* p, size_t len, int& out) {
+    while (len > 0 && (*p == ' ' || *p == '\t')) { ++p; --len; }
+    while (len > 0 && (p[len - 1] == ' ' || p[len - 1] == '\t')) --len;
+    if (len == 0) return false;
+
+    bool negative = false;
+    if (*p == '-' || *p == '+') {
+        negative = *p == '-';
+        ++p;
+        --len;
+        if (len == 0) return false;
+    }
+    long long v = 0;
+    for (size_t i = 0; i < len; ++i) {
+        const unsigned d = (unsigned)(p[i] - '0');
+        if (d > 9) return false;
+        v = v * 10 + d;
+        if (v > (long long)INT_MAX + 1) return false;
+    }
+    if (negative) v = -v;
+    if (v < INT_MIN || v > INT_MAX) return false;
+    out = (int)v;
+    return true;
+}
+
+// Spill kaydı: isim uzunluğu UTF-16 birim
+struct FixedRecord {
+    int32_t sales;
+    int32_t volume;
+    int32_t nameLen;
+};
+
+}
+
+// -------------------- yazma
+bool CatalogFile::write(const ProductCatalog& catalog, const QString& path, QString* error) {
+    const int n = catalog.size();
+    int64_t nameChars = 0;
+    for (int i = 0; i < n; ++i) {
+        // open() bu dosyayı reddederdi
+        if (catalog.volume(i) <= 0) return fail(error, "Hacmi pozitif olmayan ürün.");
+        nameChars += catalog.name(i).size();
+    }
+    const FileHeader h = makeHeader(n, nameChars);
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) return fail(error, file.errorString());
+
+    ChunkWriter out(file, 1 << 20);
+    out.put(&h, sizeof(h));
+    out.put(catalog.salesData(), (size_t)n * 4);
+    out.padTo8(h.salesAt + (int64_t)n * 4);
+    out.put(catalog.volumeData(), (size_t)n * 4);
+    out.padTo8(h.volumeAt + (int64_t)n * 4);
+
+    int64_t off = 0;
+    out.put(&off, sizeof(off));
+    for (int i = 0; i < n; ++i) {
+        off += catalog.name(i).size();
+        out.put(&off, sizeof(off));
+    }
+    for (int i = 0; i < n; ++i) {
+        const QStringView s = catalog.name(i);
+        out.put(s.data(), (size_t)s.size() * sizeof(QChar));
+    }
+
+    if (!out.flush()) {
+        file.cancelWriting();
+        return fail(error, file.errorString());
+    }
+    if (!file.commit()) return fail(error, file.errorString());
+    return true;
+}
+
+// -------------------- açma
+// verify: isim ofsetlerinin sıralı ve hacimlerin pozitif olduğunu tek geçişte, O(n) denetle
+static bool openMapped(const QString& path, ProductCatalog& out, QString* error,
+                       CatalogFileInfo* info, bool verify) {
+    auto file = std::make_shared<QFile>(path);
+    if (!file->open(QIODevice::ReadOnly)) return fail(error, file->errorString());
+
+    const qint64 size = file->size();
+    if (size < (qint64)sizeof(FileHeader)) return fail(error, "Katalog dosyası çok kısa.");
+
+    // Eşleme QFile açık kaldıkça geçerli; QFile katalogla birlikte yaşar
+    const uchar* base = file->map(0, size);
+    if (!base) return fail(error, file->errorString());
+
+    FileHeader h;
+    std::memcpy(&h, base, sizeof(h));
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0) return fail(error, "Katalog dosyası değil.");
+    if (h.byteOrder != kByteOrderMark) return fail(error, "Katalog farklı bayt sıralı bir makinede yazılmış.");
+    if (h.version != CatalogFile::kVersion)
+        return fail(error, QString("Desteklenmeyen katalog sürümü: %1").arg(h.version));
+    if (h.count < 0 || h.count > INT_MAX || h.nameChars < 0) return fail(error, "Katalog başlığı bozuk.");
+
+    const FileHeader expect = makeHeader(h.count, h.nameChars);
+    if (h.salesAt != expect.salesAt || h.volumeAt != expect.volumeAt
+        || h.offsetsAt != expect.offsetsAt || h.namesAt != expect.namesAt)
+        return fail(error, "Katalog bölüm ofsetleri bozuk.");
+    // nameChars dosyadan gelir: çarpım taşmasın diye kalan boyuta bölünerek karşılaştırılır
+    if (h.nameChars < 0 || h.nameChars > (size - h.namesAt) / (int64_t)sizeof(QChar))
+        return fail(error, "Katalog dosyası kesik.");
+
+    const int n = (int)h.count;
+    const int64_t* offsets = reinterpret_cast<const int64_t*>(base + h.offsetsAt);
+    if (offsets[0] != 0 || offsets[n] != h.nameChars) return fail(error, "İsim ofsetleri bozuk.");
+    const int* volume = reinterpret_cast<const int*>(base + h.volumeAt);
+    if (verify) {
+        for (int i = 0; i < n; ++i) {
+            if (offsets[i] > offsets[i + 1]) return fail(error, "İsim ofsetleri sıralı değil.");
+            if (volume[i] <= 0) return fail(error, "Hacmi pozitif olmayan ürün.");
+        }
+    }
+
+    BorrowedCatalogColumns cols;
+    cols.count       = n;
+    cols.sales       = reinterpret_cast<const int*>(base + h.salesAt);
+    cols.volume      = volume;
+    cols.nameOffsets = offsets;
+    cols.names       = reinterpret_cast<const QChar*>(base + h.namesAt);
+    cols.keepAlive   = file;
+    out = ProductCatalog::fromBorrowed(std::move(cols));
+
+    if (info) {
+        info->version   = (int)h.version;
+        info->count     = h.count;
+        info->nameChars = h.nameChars;
+        info->fileBytes = size;
+    }
+    return true;
+}
+
+bool CatalogFile::open(const QString& path, ProductCatalog& out, QString* error, CatalogFileInfo* info) {
+    return openMapped(path, out, error, info, true);
+}
+
+bool CatalogFile::openTrusted(const QString& path, ProductCatalog& out, QString* error,
+                              CatalogFileInfo* info) {
+    return openMapped(path, out, error, info, false);
+}
+
+// -------------------- CSV içe aktarma
+bool CatalogFile::importCsv(const QString& csvPath, const QString& outPath,
+                            const CsvImportOptions& options, CsvImportStats* stats, QString* error) {
+    Stopwatch sw;
+    CsvImportStats local;
+    CsvImportStats& st = stats ? *stats : local;
+    st = CsvImportStats();
+
+    const int chunk = std::max(4096, options.chunkBytes);
+    const char delim = options.delimiter;
+
+    QFile in(csvPath);
+    if (!in.open(QIODevice::ReadOnly)) return fail(error, in.errorString());
+
+    QTemporaryFile fixedSpill, nameSpill;
+    if (!fixedSpill.open() || !nameSpill.open()) return fail(error, "Geçici dosya açılamadı.");
+
+    // 1) CSV -> (satış, hacim, isim uzunluğu) kayıtları + UTF-16 isim akışı
+    {
+        ChunkWriter fixedOut(fixedSpill, chunk);
+        ChunkWriter nameOut(nameSpill, chunk);
+
+        std::string quoted;
+        std::vector<char16_t> wide;
+        bool firstLine = true;
+        bool tooMany = false;
+
+        auto handleLine = [&](const char* p, size_t len) {
+            if (len > 0 && p[len - 1] == '\r') --len;
+            if (firstLine) {
+                firstLine = false;
+                if (len >= 3 && std::memcmp(p, "\xEF\xBB\xBF", 3) == 0) { p += 3; len -= 3; }
+                if (options.hasHeader) return;
+            }
+            if (len == 0) return;
+
+            const char* end = p + len;
+            const char* cur = p;
+
+            // İsim: tırnaklıysa "" kaçışı çözülür
+            const char* name = cur;
+            size_t nameLen = 0;
+            if (*cur == '"') {
+                quoted.clear();
+                ++cur;
+                for (;;) {
+                    if (cur == end) { ++st.skipped; return; }
+                    if (*cur == '"') {
+                        if (cur + 1 < end && cur[1] == '"') { quoted.push_back('"'); cur += 2; continue; }
+                        ++cur;
+                        break;
+                    }
+                    quoted.push_back(*cur++);
+                }
+                name = quoted.data();
+                nameLen = quoted.size();
+                if (cur == end || *cur != delim) { ++st.skipped; return; }
+            } else {
+                const char* d = static_cast<const char*>(std::memchr(cur, delim, (size_t)(end - cur)));
+                if (!d) { ++st.skipped; return; }
+                nameLen = (size_t)(d - cur);
+                cur = d;
+            }
+            ++cur;
+
+            // Satış ve hacim; fazladan sütunlar yok sayılır
+            const char* d = static_cast<const char*>(std::memchr(cur, delim, (size_t)(end - cur)));
+            if (!d) { ++st.skipped; return; }
+            FixedRecord rec;
+            if (!parseInt(cur, (size_t)(d - cur), rec.sales)) { ++st.skipped; return; }
+            cur = d + 1;
+            d = static_cast<const char*>(std::memchr(cur, delim, (size_t)(end - cur)));
+            if (!parseInt(cur, (size_t)((d ? d : end) - cur), rec.volume)) { ++st.skipped; return; }
+            if (rec.sales < 0 || rec.volume <= 0) { ++st.skipped; return; }
+
+            if (st.rows == INT_MAX) { tooMany = true; return; }
+
+            // ASCII isimler doğrudan genişletilir, diğerleri UTF-8 çözülür
+            bool ascii = true;
+            for (size_t i = 0; i < nameLen && ascii; ++i) ascii = (unsigned char)name[i] < 0x80;
+            if (ascii) {
+                wide.resize(nameLen);
+                for (size_t i = 0; i < nameLen; ++i) wide[i] = (char16_t)(unsigned char)name[i];
+                nameOut.put(wide.data(), nameLen * sizeof(char16_t));
+                rec.nameLen = (int32_t)nameLen;
+            } else {
+                const QString s = QString::fromUtf8(name, (qsizetype)nameLen);
+                nameOut.put(s.constData(), (size_t)s.size() * sizeof(QChar));
+                rec.nameLen = (int32_t)s.size();
+            }
+            fixedOut.put(&rec, sizeof(rec));
+            st.nameChars += rec.nameLen;
+            ++st.rows;
+        };
+
+        // Tampon yalnızca tek satır ondan uzunsa büyür
+        std::vector<char> buf((size_t)chunk);
+        size_t have = 0;
+        for (;;) {
+            if (have == buf.size()) buf.resize(buf.size() * 2);
+            const qint64 got = in.read(buf.data() + have, (qint64)(buf.size() - have));
+            if (got < 0) return fail(error, in.errorString());
+            st.bytesRead += got;
+            have += (size_t)got;
+
+            size_t start = 0;
+            for (;;) {
+                const char* nl = static_cast<const char*>(std::memchr(buf.data() + start, '\n', have - start));
+                if (!nl) break;
+                handleLine(buf.data() + start, (size_t)(nl - (buf.data() + start)));
+                start = (size_t)(nl - buf.data()) + 1;
+            }
+            if (tooMany) return fail(error, "CSV satır sayısı katalog sınırını aşıyor.");
+
+            if (got == 0) {
+                if (start < have) handleLine(buf.data() + start, have - start);
+                break;
+            }
+            std::memmove(buf.data(), buf.data() + start, have - start);
+            have -= start;
+        }
+        if (tooMany) return fail(error, "CSV satır sayısı katalog sınırını aşıyor.");
+
+        st.peakBufferBytes = (long long)buf.size() + 2LL * chunk;
+        if (!fixedOut.flush() || !nameOut.flush()) return fail(error, "Geçici dosyaya yazılamadı.");
+    }
+
+    // 2) Sabit genişlikli sütunlar kayıtlardan üç geçişte, isimler tek kopyayla
+    const FileHeader h = makeHeader(st.rows, st.nameChars);
+    QSaveFile outFile(outPath);
+    if (!outFile.open(QIODevice::WriteOnly)) return fail(error, outFile.errorString());
+
+    bool readOk = true;
+    std::vector<FixedRecord> recs(std::max<size_t>(1, (size_t)chunk / sizeof(FixedRecord)));
+    auto eachRecord = [&](auto&& emit) {
+        if (!readOk || !fixedSpill.seek(0)) { readOk = false; return; }
+        for (;;) {
+            const qint64 got = fixedSpill.read(reinterpret_cast<char*>(recs.data()),
+                                               (qint64)(recs.size() * sizeof(FixedRecord)));
+            if (got < 0 || got % (qint64)sizeof(FixedRecord) != 0) { readOk = false; return; }
+            if (got == 0) return;
+            const size_t k = (size_t)got / sizeof(FixedRecord);
+            for (size_t i = 0; i < k; ++i) emit(recs[i]);
+        }
+    };
+
+    ChunkWriter out(outFile, chunk);
+    out.put(&h, sizeof(h));
+    eachRecord([&](const FixedRecord& r) { out.put(&r.sales, sizeof(int32_t)); });
+    out.padTo8(h.salesAt + h.count * 4);
+    eachRecord([&](const FixedRecord& r) { out.put(&r.volume, sizeof(int32_t)); });
+    out.padTo8(h.volumeAt + h.count * 4);
+
+    int64_t off = 0;
+    out.put(&off, sizeof(off));
+    eachRecord([&](const FixedRecord& r) {
+        off += r.nameLen;
+        out.put(&off, sizeof(off));
+    });
+
+    std::vector<char> copyBuf((size_t)chunk);
+    if (readOk && nameSpill.seek(0)) {
+        for (;;) {
+            const qint64 got = nameSpill.read(copyBuf.data(), (qint64)copyBuf.size());
+            if (got < 0) { readOk = false; break; }
+            if (got == 0) break;
+            out.put(copyBuf.data(), (size_t)got);
+        }
+    } else {
+        readOk = false;
+    }
+
+    if (!readOk) {
+        outFile.cancelWriting();
+        return fail(error, "Geçici dosya okunamadı.");
+    }
+    if (!out.flush()) {
+        outFile.cancelWriting();
+        return fail(error, outFile.errorString());
+    }
+    if (!outFile.commit()) return fail(error, outFile.errorString());
+
+    st.peakBufferBytes = std::max(st.peakBufferBytes,
+                                  (long long)(recs.size() * sizeof(FixedRecord) + copyBuf.size()) + chunk);
+    st.elapsedMs = sw.elapsedNs() / 1000000;
+    return true;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <QString>
+
+#include "../model/ProductCatalog.h"
+
+struct CsvImportOptions {
+    char delimiter = ',';
+    bool hasHeader = true;          // ilk satır başlık (atlanır)
+    int chunkBytes = 1 << 20;       // okuma ve her yazma tamponunun boyutu
+};
+
+struct CsvImportStats {
+    long long rows = 0;             // kataloğa giren satır
+    long long skipped = 0;          // alan eksik / sayı geçersiz
+    long long bytesRead = 0;
+    long long nameChars = 0;        // UTF-16 birim
+    long long peakBufferBytes = 0;  // okuma + yazma tamponları (satır sayısından bağımsız)
+    long long elapsedMs = 0;
+};
+
+struct CatalogFileInfo {
+    int version = 0;
+    long long count = 0;
+    long long nameChars = 0;
+    long long fileBytes = 0;
+};
+
+// Sürümlü ikili katalog dosyası (yerel bayt sırası, 8 bayt hizalı bölümler):
+//   başlık (64 B): "WHCATLOG", sürüm, bayt sırası işareti, ürün sayısı,
+//                  isim uzunluğu, bölüm ofsetleri
+//   int32  satış[n]
+//   int32  hacim[n]
+//   int64  isimOfset[n + 1]     (UTF-16 birim; isimOfset[0] = 0)
+//   UTF-16 isimler
+// Açılış dosyayı belleğe eşler; katalog sütunları doğrudan dosyaya işaret eder.
+class CatalogFile {
+public:
+    static constexpr uint32_t kVersion = 1;
+
+    static bool write(const ProductCatalog& catalog, const QString& path, QString* error = nullptr);
+
+    // Tam doğrulama: başlık, bölüm sınırları, sıralı isim ofsetleri ve pozitif hacimler, O(n)
+    static bool open(const QString& path, ProductCatalog& out, QString* error = nullptr,
+                     CatalogFileInfo* info = nullptr);
+
+    // Güvenilen dosya (bu süreçte yazılmış / önceden doğrulanmış): yalnızca başlık ve
+    // bölüm sınırları, ürün sayısından bağımsız
+    static bool openTrusted(const QString& path, ProductCatalog& out, QString* error = nullptr,
+                            CatalogFileInfo* info = nullptr);
+
+    // "isim,satış,hacim" CSV'sini parça parça okuyup ikili kataloğa çevirir.
+    // Bellek tampon boyutlarıyla sınırlı: sabit genişlikli sütunlar ve isimler
+    // geçici dosyalara akar, sonunda tek geçişte birleştirilir.
+    // Tırnaklı isimler ("a,b", "" kaçışı) desteklenir; alan içinde satır sonu desteklenmez.
+    static bool importCsv(const QString& csvPath, const QString& outPath,
+                          const CsvImportOptions& options = CsvImportOptions(),
+                          CsvImportStats* stats = nullptr, QString* error = nullptr);
+};
@@ -0,0 +1,160 @@
+#include "DPKernel.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define DPKERNEL_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(DPKERNEL_X86) && (defined(__GNUC__) || defined(__clang__))
+#define DPKERNEL_TARGET(isa) __attribute__((target(isa)))
+#else
+#define DPKERNEL_TARGET(isa)
+#endif
+
+// -------------------- helpers
+// mask'in nbits bitini pos konumundan itibaren bit satırına OR'la
+static inline void orBits(uint64_t* bits, int pos, uint32_t mask, int nbits) {
+    if (mask == 0) return;
+    int word = pos >> 6;
+    int off  = pos & 63;
+    bits[word] |= (uint64_t)mask << off;
+    if (off + nbits > 64)
+        bits[word + 1] |= (uint64_t)mask >> (64 - off);
+}
+
+// [w, c] aralığı için skaler kuyruk
+static inline void scalarTail(int* row, uint64_t* takeBits, int c, int w, int v) {
+    for (; c >= w; --c) {
+        int cand = row[c - w] + v;
+        if (cand > row[c]) {
+            row[c] = cand;
+            takeBits[c >> 6] |= 1ULL << (c & 63);
+        }
+    }
+}
+
+// -------------------- Scalar
+static void rowUpdateScalar(int* row, uint64_t* takeBits, int capacity, int w, int v) {
+    if (w < 0 || w > capacity) return;
+    scalarTail(row, takeBits, capacity, w, v);
+}
+
+#ifdef DPKERNEL_X86
+// Bloklar yüksekten alçağa işlenir. Bir blok [b, b+L) okuduğu [b-w, b-w+L)
+// aralığını yazmadan önce yükler; daha yüksek bloklar zaten yazılmış ama
+// okunmuyor. Bu yüzden yerinde güncelleme skaler sürümle birebir aynıdır.
+
+// -------------------- SSE4.1 (4 x int32)
+DPKERNEL_TARGET("sse4.1")
+static void rowUpdateSSE41(int* row, uint64_t* takeBits, int capacity, int w, int v) {
+    if (w < 0 || w > capacity) return;
+
+    const __m128i vv = _mm_set1_epi32(v);
+    int c = capacity;
+    for (; c - 3 >= w; c -= 4) {
+        int b = c - 3;
+        __m128i cur  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + b));
+        __m128i src  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + b - w));
+        __m128i cand = _mm_add_epi32(src, vv);
+        __m128i gt   = _mm_cmpgt_epi32(cand, cur);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(row + b), _mm_max_epi32(cur, cand));
+        orBits(takeBits, b, (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(gt)), 4);
+    }
+    scalarTail(row, takeBits, c, w, v);
+}
+
+// -------------------- AVX2 (8 x int32)
+DPKERNEL_TARGET("avx2")
+static void rowUpdateAVX2(int* row, uint64_t* takeBits, int capacity, int w, int v) {
+    if (w < 0 || w > capacity) return;
+
+    const __m256i vv = _mm256_set1_epi32(v);
+    int c = capacity;
+    for (; c - 7 >= w; c -= 8) {
+        int b = c - 7;
+        __m256i cur  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + b));
+        __m256i src  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + b - w));
+        __m256i cand = _mm256_add_epi32(src, vv);
+        __m256i gt   = _mm256_cmpgt_epi32(cand, cur);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + b), _mm256_max_epi32(cur, cand));
+        orBits(takeBits, b, (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(gt)), 8);
+    }
+    scalarTail(row, takeBits, c, w, v);
+}
+
+// -------------------- CPUID
+static bool cpuHas(DPKernel::Isa isa) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if (isa == DPKernel::Isa::AVX2)  return __builtin_cpu_supports("avx2");
+    if (isa == DPKernel::Isa::SSE41) return __builtin_cpu_supports("sse4.1");
+    return true;
+#elif defined(_MSC_VER)
+    int info[4] = {0, 0, 0, 0};
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+    if (maxLeaf < 1) return isa == DPKernel::Isa::Scalar;
+
+    __cpuid(info, 1);
+    const bool sse41   = (info[2] & (1 << 19)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx     = (info[2] & (1 << 28)) != 0;
+    if (isa == DPKernel::Isa::SSE41) return sse41;
+    if (isa == DPKernel::Isa::AVX2) {
+        if (!osxsave || !avx || maxLeaf < 7) return false;
+        if ((_xgetbv(0) & 0x6) != 0x6) return false;   // OS YMM durumunu saklıyor mu
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    }
+    return true;
+#else
+    return isa == DPKernel::Isa::Scalar;
+#endif
+}
+#endif
+
+// -------------------- dispatch
+bool DPKernel::isSupported(Isa isa) {
+#ifdef DPKERNEL_X86
+    return cpuHas(isa);
+#else
+    return isa == Isa::Scalar;
+#endif
+}
+
+DPKernel::RowUpdateFn DPKernel::kernelFor(Isa isa) {
+    if (!isSupported(isa)) return nullptr;
+    switch (isa) {
+#ifdef DPKERNEL_X86
+        case Isa::AVX2:  return rowUpdateAVX2;
+        case Isa::SSE41: return rowUpdateSSE41;
+#endif
+        case Isa::Scalar: return rowUpdateScalar;
+        default: return nullptr;
+    }
+}
+
+DPKernel::Isa DPKernel::activeIsa() {
+    static const Isa isa = [] {
+        if (isSupported(Isa::AVX2))  return Isa::AVX2;
+        if (isSupported(Isa::SSE41)) return Isa::SSE41;
+        return Isa::Scalar;
+    }();
+    return isa;
+}
+
+DPKernel::RowUpdateFn DPKernel::active() {
+    static const RowUpdateFn fn = kernelFor(activeIsa());
+    return fn;
+}
+
+const char* DPKernel::isaName(Isa isa) {
+    switch (isa) {
+        case Isa::AVX2:  return "AVX2";
+        case Isa::SSE41: return "SSE4.1";
+        default:         return "Scalar";
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+
+// Knapsack satır güncelleme çekirdeği (yerinde, kapasite büyükten küçüğe):
+//   row[c] = max(row[c], row[c - w] + v),   w <= c <= capacity
+// Kesin artış olan her c için takeBits'in c. biti set edilir
+// (takeBits çağrıdan önce sıfırlanmış olmalı).
+// AVX2 / SSE4.1 / skaler yollar çalışma zamanında CPUID ile seçilir.
+class DPKernel {
+public:
+    enum class Isa { Scalar, SSE41, AVX2 };
+
+    using RowUpdateFn = void (*)(int* row, uint64_t* takeBits, int capacity, int w, int v);
+
+    // Seçili (en hızlı desteklenen) çekirdekle güncelle
+    static void rowUpdate(int* row, uint64_t* takeBits, int capacity, int w, int v) {
+        active()(row, takeBits, capacity, w, v);
+    }
+
+    static Isa activeIsa();
+    static bool isSupported(Isa isa);
+    static const char* isaName(Isa isa);
+
+    // Belirli bir yolun çekirdeği (desteklenmiyorsa nullptr) – benchmark için
+    static RowUpdateFn kernelFor(Isa isa);
+
+private:
+    static RowUpdateFn active();
+};
@@ -0,0 +1,114 @@
+#include "KnapsackDP.h"
+#include "DPKernel.h"
+
+#include <algorithm>
+
+// -------------------- DecisionBits
+void DecisionBits::reset(int rows, int cols) {
+    wordsPerRow = (cols + 63) / 64;
+    bits.assign((size_t)rows * wordsPerRow, 0ULL);
+}
+
+// -------------------- KnapsackDP
+int KnapsackDP::solve(const int* weights, const int* values, int n, int capacity,
+                      std::vector<int>& picked) {
+    picked.clear();
+    row.assign(capacity + 1, 0);
+    if (n <= 0 || capacity < 0) return 0;
+
+    take.reset(n, capacity + 1);
+
+    int* dp = row.data();
+    for (int i = 0; i < n; ++i) {
+        // dp[cap] = max(dp[cap], dp[cap - w] + v); sadece kesin artışta "al"
+        DPKernel::rowUpdate(dp, take.row(i), capacity, weights[i], values[i]);
+    }
+
+    int cap = capacity;
+    for (int i = n - 1; i >= 0; --i) {
+        if (take.test(i, cap)) {
+            picked.push_back(i);
+            cap -= weights[i];
+        }
+    }
+    return dp[capacity];
+}
+
+// -------------------- IncrementalKnapsackDP
+void IncrementalKnapsackDP::init(const int* weights, const int* values, int count, int cap) {
+    w = weights;
+    v = values;
+    n = std::max(0, count);
+    capacity = cap;
+    liveCount = n;
+    validRows = 0;
+
+    alive.assign(n, 1);
+    row.assign(capacity + 1, 0);
+    checkpoints.assign((size_t)(n / kCheckpointStride) * (capacity + 1), 0);
+    take.reset(n, capacity + 1);
+}
+
+int IncrementalKnapsackDP::solveNext(std::vector<int>& picked) {
+    picked.clear();
+    if (liveCount == 0 || capacity < 0) return 0;
+
+    const int width = capacity + 1;
+    int best = 0;
+    {
+        ScopedPhase phase(profile, PlacementPhase::DPFill);
+
+        // En yakın geçerli kontrol noktasından devam et
+        int cp = validRows / kCheckpointStride - 1;
+        int start = 0;
+        if (cp >= 0) {
+            const int* src = checkpoints.data() + (size_t)cp * width;
+            std::copy(src, src + width, row.begin());
+            start = (cp + 1) * kCheckpointStride;
+        } else {
+            std::fill(row.begin(), row.end(), 0);
+        }
+
+        long long cells = 0;
+        int* dp = row.data();
+        for (int i = start; i < n; ++i) {
+            if (alive[i]) {
+                uint64_t* bits = take.row(i);
+                std::fill(bits, bits + take.words(), 0ULL);
+                DPKernel::rowUpdate(dp, bits, capacity, w[i], v[i]);
+                if (w[i] >= 0 && w[i] <= capacity) cells += capacity - w[i] + 1;
+            }
+            if ((i + 1) % kCheckpointStride == 0) {
+                int k = (i + 1) / kCheckpointStride - 1;
+                std::copy(row.begin(), row.end(), checkpoints.begin() + (size_t)k * width);
+            }
+        }
+        best = dp[capacity];
+
+        if (profile) {
+            profile->count(PlacementCounter::CellsEvaluated, cells);
+            profile->count(PlacementCounter::ItemsScanned, n - start);
+        }
+    }
+
+    {
+        ScopedPhase phase(profile, PlacementPhase::Traceback);
+        int c = capacity;
+        for (int i = n - 1; i >= 0; --i) {
+            if (alive[i] && take.test(i, c)) {
+                picked.push_back(i);
+                c -= w[i];
+            }
+        }
+    }
+
+    // İlk seçilen indeksten önceki satırlar bir sonraki raf için geçerli
+    ScopedPhase phase(profile, PlacementPhase::Compaction);
+    validRows = n;
+    for (int idx : picked) {
+        alive[idx] = 0;
+        validRows = std::min(validRows, idx);
+    }
+    liveCount -= (int)picked.size();
+    return best;
+}
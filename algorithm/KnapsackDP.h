@@ -0,0 +1,83 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include "PlacementProfile.h"
+
+// Bit-paketli karar matrisi: (satır i, kapasite c) -> "i. ürün alındı mı"
+// int tablosuna göre 32 kat daha az bellek.
+class DecisionBits {
+public:
+    void reset(int rows, int cols);
+
+    uint64_t* row(int r) { return bits.data() + (size_t)r * wordsPerRow; }
+    const uint64_t* row(int r) const { return bits.data() + (size_t)r * wordsPerRow; }
+
+    bool test(int r, int c) const {
+        return (row(r)[c >> 6] >> (c & 63)) & 1ULL;
+    }
+
+    int words() const { return wordsPerRow; }
+
+private:
+    std::vector<uint64_t> bits;
+    int wordsPerRow = 0;
+};
+
+// 0/1 knapsack motoru: tek bitişik (rolling) değer satırı + karar bitleri.
+// Satır yerinde, kapasite büyükten küçüğe güncellenir; sonuç tam
+// (n+1)x(C+1) int tablosuyla birebir aynıdır.
+class KnapsackDP {
+public:
+    // weights/values: n elemanlı bitişik diziler
+    // picked: seçilen indeksler (traceback sırasıyla, büyükten küçüğe)
+    int solve(const int* weights, const int* values, int n, int capacity,
+              std::vector<int>& picked);
+
+    // Son satır: kapasite başına en iyi değer
+    const std::vector<int>& lastRow() const { return row; }
+
+private:
+    std::vector<int> row;
+    DecisionBits take;
+};
+
+// Çok raflı artımlı mod: ürün sırası sabit, seçilenler canlılık maskesinden
+// düşülür (erase yok). İlk silinen indeksten önceki satırlar geçerli kalır;
+// değer satırı her kCheckpointStride satırda bir saklanır ve bir sonraki raf
+// en yakın geçerli kontrol noktasından devam eder.
+class IncrementalKnapsackDP {
+public:
+    static constexpr int kCheckpointStride = 32;
+
+    // weights/values dizileri nesne yaşadığı sürece geçerli kalmalı
+    void init(const int* weights, const int* values, int n, int capacity);
+
+    // Canlı ürünler üzerinde bir raf çöz; seçilenler maskeden düşülür.
+    // picked: orijinal indeksler (büyükten küçüğe)
+    int solveNext(std::vector<int>& picked);
+
+    bool isAlive(int i) const { return alive[i] != 0; }
+    int aliveCount() const { return liveCount; }
+
+    // Son çözülen rafın son satırı
+    const std::vector<int>& lastRow() const { return row; }
+
+    // Faz süreleri ve sayaçlar buraya eklenir (nullptr: ölçüm yok)
+    void setProfile(PlacementProfile* p) { profile = p; }
+
+private:
+    PlacementProfile* profile = nullptr;
+    const int* w = nullptr;
+    const int* v = nullptr;
+    int n = 0;
+    int capacity = 0;
+    int liveCount = 0;
+    int validRows = 0;   // [0, validRows) satırları hâlâ geçerli
+
+    std::vector<uint8_t> alive;
+    std::vector<int> row;
+    std::vector<int> checkpoints;  // k. blok: (k+1)*stride satır sonrası değer satırı
+    DecisionBits take;
+};
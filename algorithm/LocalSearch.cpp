@@ -0,0 +1,412 @@
+#include "LocalSearch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <set>
+#include <utility>
+
+namespace {
+
+// Sözlük sıralı amaç farkı: (birincil, ikincil)
+struct Gain {
+    long long primary = 0;
+    long long secondary = 0;
+
+    bool positive() const { return primary > 0 || (primary == 0 && secondary > 0); }
+    Gain operator+(const Gain& o) const { return {primary + o.primary, secondary + o.secondary}; }
+    Gain operator-(const Gain& o) const { return {primary - o.primary, secondary - o.secondary}; }
+    bool operator<(const Gain& o) const {
+        return primary != o.primary ? primary < o.primary : secondary < o.secondary;
+    }
+};
+
+class Engine {
+public:
+    Engine(const ShelfLayout& start, const ProductCatalog& catalog,
+           const LocalSearchOptions& options, LocalSearchStats& stats)
+        : w(catalog.volumeData()), v(catalog.salesData()), n(catalog.size()),
+          m(start.shelfCount()), cap(start.capacity), opt(options), st(stats), rng(options.seed) {
+        deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(0, opt.timeBudgetMs));
+
+        // Hacme göre sıralı konumlar (havuz ağacı yaprakları)
+        byWeight.resize(n);
+        std::iota(byWeight.begin(), byWeight.end(), 0);
+        std::stable_sort(byWeight.begin(), byWeight.end(), [&](int a, int b) { return w[a] < w[b]; });
+        rank.resize(n);
+        sortedW.resize(n);
+        for (int r = 0; r < n; ++r) {
+            rank[byWeight[r]] = r;
+            sortedW[r] = w[byWeight[r]];
+        }
+        leaves = 1;
+        while (leaves < std::max(1, n)) leaves <<= 1;
+
+        shelfOf.assign(n, -1);
+        for (int s = 0; s < m; ++s)
+            for (int k = start.offsets[s]; k < start.offsets[s + 1]; ++k)
+                shelfOf[start.items[k]] = s;
+        rebuild();
+        best = shelfOf;
+        bestScore = score();
+    }
+
+    void run() {
+        st.startSales = sales;
+        st.startUsed = usedTotal;
+
+        descend();
+        if (better(score(), bestScore)) { best = shelfOf; bestScore = score(); }
+
+        // Tur hamleleri geri alma günlüğüne yazılır: kötüleşen tur O(hamle)
+        // geri alınır, tam kopya yalnızca en iyi iyileşince alınır
+        int stall = 0;
+        while (!timeUp() && stall < opt.maxStallRounds) {
+            undo.clear();
+            logging = true;
+            perturb();
+            descend();
+            logging = false;
+            ++st.perturbations;
+
+            const Gain now = score();
+            if (better(now, bestScore)) {
+                best = shelfOf;
+                bestScore = now;
+                stall = 0;
+            } else {
+                ++stall;
+                if (bestScore.primary != now.primary || bestScore.secondary != now.secondary) revert();
+            }
+        }
+        st.budgetExhausted = timeUp();
+
+        shelfOf = best;
+        rebuild();
+        st.finalSales = sales;
+        st.finalUsed = usedTotal;
+    }
+
+    ShelfLayout result() const {
+        ShelfLayoutBuilder b;
+        b.reset(m, m > 0 ? cap[0] : 0);
+        for (int s = 0; s < m; ++s)
+            for (int i : members[s]) b.place(s, i, w[i]);
+        ShelfLayout out = b.finish();
+        out.capacity = cap;
+        return out;
+    }
+
+private:
+    // -------------------- amaç
+    Gain key(int i) const {
+        if (opt.objective == LocalSearchObjective::Fill) return {w[i], v[i]};
+        return {v[i], w[i]};
+    }
+    Gain score() const {
+        if (opt.objective == LocalSearchObjective::Fill) return {usedTotal, sales};
+        return {sales, usedTotal};
+    }
+    static bool better(const Gain& a, const Gain& b) { return b < a; }
+
+    long long residual(int s) const { return cap[s] - used[s]; }
+
+    // s dışında, i'nin sığdığı en az boşluklu raf (eşitlikte küçük raf), yoksa -1
+    int bestTarget(int i, int s) const {
+        auto it = byResidual.lower_bound({(long long)w[i], -1});
+        if (it != byResidual.end() && it->second == s) ++it;
+        return it == byResidual.end() ? -1 : it->second;
+    }
+    void setUsed(int s, long long value) {
+        byResidual.erase({residual(s), s});
+        used[s] = value;
+        byResidual.emplace(residual(s), s);
+    }
+
+    bool timeUp() {
+        if ((++clockTick & 63) == 0 && std::chrono::steady_clock::now() >= deadline) expired = true;
+        return expired;
+    }
+
+    // -------------------- havuz ağacı: hacim sıralı yapraklarda en iyi yerleşmemiş ürün
+    bool prefer(int a, int b) const {
+        if (a < 0) return false;
+        if (b < 0) return true;
+        return key(b) < key(a);
+    }
+    void setLeaf(int i, bool inPool) {
+        int node = leaves + rank[i];
+        tree[node] = inPool ? i : -1;
+        for (node >>= 1; node >= 1; node >>= 1)
+            tree[node] = prefer(tree[2 * node], tree[2 * node + 1]) ? tree[2 * node] : tree[2 * node + 1];
+    }
+    // Hacmi <= limit olan en iyi havuz ürünü, yoksa -1
+    int bestFitting(long long limit) const {
+        if (limit < 0) return -1;
+        const int end = (int)(std::upper_bound(sortedW.begin(), sortedW.end(), limit) - sortedW.begin());
+        int bestItem = -1;
+        int lo = leaves, hi = leaves + end;   // [lo, hi)
+        while (lo < hi) {
+            if (lo & 1) { if (prefer(tree[lo], bestItem)) bestItem = tree[lo]; ++lo; }
+            if (hi & 1) { --hi; if (prefer(tree[hi], bestItem)) bestItem = tree[hi]; }
+            lo >>= 1;
+            hi >>= 1;
+        }
+        return bestItem;
+    }
+
+    // -------------------- durum
+    void rebuild() {
+        members.assign(m, {});
+        used.assign(m, 0);
+        pos.assign(n, -1);
+        sales = 0;
+        usedTotal = 0;
+        tree.assign(2 * leaves, -1);
+        for (int i = 0; i < n; ++i) {
+            const int s = shelfOf[i];
+            if (s < 0) { tree[leaves + rank[i]] = i; continue; }
+            pos[i] = (int)members[s].size();
+            members[s].push_back(i);
+            used[s] += w[i];
+            sales += v[i];
+            usedTotal += w[i];
+        }
+        for (int node = leaves - 1; node >= 1; --node)
+            tree[node] = prefer(tree[2 * node], tree[2 * node + 1]) ? tree[2 * node] : tree[2 * node + 1];
+
+        byResidual.clear();
+        for (int s = 0; s < m; ++s) byResidual.emplace(residual(s), s);
+    }
+
+    void place(int i, int s) {
+        if (logging) undo.emplace_back(i, shelfOf[i]);
+        shelfOf[i] = s;
+        pos[i] = (int)members[s].size();
+        members[s].push_back(i);
+        setUsed(s, used[s] + w[i]);
+        sales += v[i];
+        usedTotal += w[i];
+        setLeaf(i, false);
+    }
+    void unplace(int i) {
+        const int s = shelfOf[i];
+        if (logging) undo.emplace_back(i, s);
+        std::vector<int>& mem = members[s];
+        const int p = pos[i];
+        mem[p] = mem.back();
+        pos[mem[p]] = p;
+        mem.pop_back();
+        setUsed(s, used[s] - w[i]);
+        sales -= v[i];
+        usedTotal -= w[i];
+        shelfOf[i] = -1;
+        pos[i] = -1;
+        setLeaf(i, true);
+    }
+
+    // Günlük sondan başa: her kayıt ürünün hamleden önceki rafı
+    void revert() {
+        for (auto it = undo.rbegin(); it != undo.rend(); ++it) {
+            const int i = it->first, prev = it->second;
+            if (shelfOf[i] >= 0) unplace(i);
+            if (prev >= 0) place(i, prev);
+        }
+        undo.clear();
+    }
+
+    // -------------------- komşuluklar (ilk iyileştiren kabul edilir)
+    bool insertPass() {
+        bool improved = false;
+        for (int s = 0; s < m && !timeUp(); ++s) {
+            for (;;) {
+                ++st.evaluations;
+                const int u = bestFitting(residual(s));
+                if (u < 0 || !key(u).positive()) break;
+                place(u, s);
+                ++st.inserts;
+                improved = true;
+            }
+        }
+        return improved;
+    }
+
+    // Hamle sonrası k yuvasına başka bir ürün geldiği için k ilerletilmez;
+    // her hamle amacı kesin artırdığından döngü sonludur
+    bool swapPass() {
+        bool improved = false;
+        for (int s = 0; s < m && !timeUp(); ++s) {
+            for (size_t k = 0; k < members[s].size();) {
+                const int i = members[s][k];
+                const long long space = residual(s) + w[i];
+
+                // 1 <-> 1
+                ++st.evaluations;
+                const int u1 = bestFitting(space);
+                if (u1 < 0) { ++k; continue; }
+                if ((key(u1) - key(i)).positive()) {
+                    unplace(i);
+                    place(u1, s);
+                    ++st.swaps;
+                    improved = true;
+                    continue;
+                }
+
+                // 1 -> 2: en iyi sığan, ardından kalan boşluğa sığan en iyi
+                ++st.evaluations;
+                setLeaf(u1, false);
+                const int u2 = bestFitting(space - w[u1]);
+                setLeaf(u1, true);
+                if (u2 >= 0 && (key(u1) + key(u2) - key(i)).positive()) {
+                    unplace(i);
+                    place(u1, s);
+                    place(u2, s);
+                    ++st.oneForTwo;
+                    improved = true;
+                    continue;
+                }
+                ++k;
+            }
+        }
+        return improved;
+    }
+
+    bool twoForOnePass() {
+        bool improved = false;
+        for (int s = 0; s < m && !timeUp(); ++s) {
+            bool changed = true;
+            while (changed && !expired) {
+                changed = false;
+                const std::vector<int>& mem = members[s];
+                for (size_t a = 0; a < mem.size() && !changed; ++a) {
+                    for (size_t b = a + 1; b < mem.size(); ++b) {
+                        if (timeUp()) break;
+                        const int i = mem[a], j = mem[b];
+                        ++st.evaluations;
+                        const int u = bestFitting(residual(s) + w[i] + w[j]);
+                        if (u < 0 || !(key(u) - key(i) - key(j)).positive()) continue;
+                        unplace(i);
+                        unplace(j);
+                        place(u, s);
+                        ++st.twoForOne;
+                        improved = changed = true;
+                        break;
+                    }
+                }
+            }
+        }
+        return improved;
+    }
+
+    // Bir ürünü başka rafa taşı (amaç değişmez), boşalan yere havuzdan ekle
+    bool relocatePass() {
+        bool improved = false;
+        for (int s = 0; s < m && !timeUp(); ++s) {
+            for (size_t k = 0; k < members[s].size();) {
+                const int i = members[s][k];
+                ++st.evaluations;
+                const int u = bestFitting(residual(s) + w[i]);
+                if (u < 0 || !key(u).positive() || w[u] <= residual(s)) { ++k; continue; }
+
+                // Hedef raf: i'nin sığdığı en dolu raf (best-fit)
+                const int t = bestTarget(i, s);
+                if (t < 0) { ++k; continue; }
+
+                // k yuvasına başka ürün gelir; swapPass'teki gibi yeniden incelenir
+                unplace(i);
+                place(i, t);
+                place(u, s);
+                ++st.relocations;
+                improved = true;
+            }
+        }
+        return improved;
+    }
+
+    void descend() {
+        bool improved = true;
+        while (improved && !timeUp()) {
+            improved = insertPass();
+            improved |= swapPass();
+            improved |= relocatePass();
+            if (!improved) improved = twoForOnePass();
+        }
+    }
+
+    // Birkaç ürünü havuza geri gönder, birkaçını raflar arasında karıştır
+    void perturb() {
+        if (usedTotal == 0 || m == 0) return;
+        std::uniform_int_distribution<int> shelfDist(0, m - 1);
+
+        const int removals = 1 + (int)(rng() % 3);
+        for (int r = 0; r < removals; ++r) {
+            const int s = shelfDist(rng);
+            if (members[s].empty()) continue;
+            unplace(members[s][rng() % members[s].size()]);
+        }
+        const int shuffles = 2 + (int)(rng() % 4);
+        for (int r = 0; r < shuffles && m > 1; ++r) {
+            const int s = shelfDist(rng), t = shelfDist(rng);
+            if (s == t || members[s].empty()) continue;
+            const int i = members[s][rng() % members[s].size()];
+            if (residual(t) < w[i]) continue;
+            unplace(i);
+            place(i, t);
+        }
+    }
+
+    const int* w;
+    const int* v;
+    const int n;
+    const int m;
+    const std::vector<int> cap;
+    const LocalSearchOptions& opt;
+    LocalSearchStats& st;
+    std::mt19937_64 rng;
+    std::chrono::steady_clock::time_point deadline;
+    unsigned clockTick = 0;
+    bool expired = false;
+
+    std::vector<int> byWeight, rank, sortedW;
+    int leaves = 1;
+    std::vector<int> tree;
+
+    std::vector<int> shelfOf, pos;
+    std::vector<std::vector<int>> members;
+    std::vector<long long> used;
+    std::set<std::pair<long long, int>> byResidual;   // (kalan, raf)
+    long long sales = 0, usedTotal = 0;
+
+    std::vector<int> best;
+    Gain bestScore;
+
+    std::vector<std::pair<int, int>> undo;   // (ürün, önceki raf)
+    bool logging = false;
+};
+
+}
+
+ShelfLayout LocalSearch::improve(const ShelfLayout& start, const ProductCatalog& catalog,
+                                 const LocalSearchOptions& options,
+                                 LocalSearchStats* stats, PlacementProfile* profile) {
+    LocalSearchStats local;
+    LocalSearchStats& st = stats ? *stats : local;
+    st = LocalSearchStats();
+
+    const long long t0 = steadyNowNs();
+    ShelfLayout out;
+    {
+        ScopedPhase phase(profile, PlacementPhase::ShelfFill);
+        Engine engine(start, catalog, options, st);
+        engine.run();
+        out = engine.result();
+    }
+    st.elapsedUs = (steadyNowNs() - t0) / 1000;
+
+    if (profile) {
+        profile->count(PlacementCounter::ItemsScanned, st.evaluations);
+        profile->count(PlacementCounter::ItemsPlaced, out.itemCount());
+    }
+    return out;
+}
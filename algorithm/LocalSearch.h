@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "../model/ShelfLayout.h"
+#include "../model/ProductCatalog.h"
+#include "PlacementProfile.h"
+
+enum class LocalSearchObjective {
+    Sales,   // önce toplam satış, eşitlikte doluluk
+    Fill     // önce doluluk (kullanılan hacim), eşitlikte satış
+};
+
+struct LocalSearchOptions {
+    int timeBudgetMs = 50;                               // duvar saati bütçesi
+    LocalSearchObjective objective = LocalSearchObjective::Sales;
+    uint64_t seed = 1;                                   // pertürbasyon
+    int maxStallRounds = 200;                            // iyileşmeyen pertürbasyon sınırı
+};
+
+struct LocalSearchStats {
+    long long inserts = 0;        // havuzdan rafa
+    long long swaps = 0;          // raftaki 1 <-> havuzdan 1
+    long long oneForTwo = 0;      // raftaki 1 -> havuzdan 2
+    long long twoForOne = 0;      // raftaki 2 -> havuzdan 1
+    long long relocations = 0;    // raflar arası taşıma + boşalan yere ekleme
+    long long perturbations = 0;
+    long long evaluations = 0;    // değerlendirilen komşu
+
+    long long startSales = 0, finalSales = 0;
+    long long startUsed = 0,  finalUsed = 0;
+    long long elapsedUs = 0;
+    bool budgetExhausted = false; // false: durgunluk sınırıyla erken bitti
+};
+
+// Herhangi bir yerleşimi raflar ve yerleşmemiş ürün havuzu arasında
+// taşıma / takas / 2'ye-1 komşuluklarıyla iyileştiren anytime arama.
+// - Her hamle bir havuz sorgusuyla puanlanır: "L hacmine sığan en iyi havuz ürünü"
+//   hacme göre sıralı bir maks-ağaçla O(log n); fark raf toplamlarından hesaplanır
+// - Taşıma hedefi (ürünün sığdığı en dolu raf) (kalan, raf) kümesinden O(log m)
+// - Hamle uygulaması ağaç ve küme güncellemeleriyle O(log n + log m)
+// - Yerel optimumda rastgele pertürbasyon; iyileştirmeyen tur hamle günlüğünden
+//   geri alınır (hamle başına O(log n + log m)), bütçe bitince en iyi çözüm döner
+class LocalSearch {
+public:
+    // start: başlangıç yerleşimi (raf kapasiteleri buradan alınır)
+    static ShelfLayout improve(const ShelfLayout& start, const ProductCatalog& catalog,
+                               const LocalSearchOptions& options,
+                               LocalSearchStats* stats = nullptr,
+                               PlacementProfile* profile = nullptr);
+};
@@ -0,0 +1,298 @@
+#include "MultiKnapsackBB.h"
+#include "WorkStealingPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <utility>
+
+namespace {
+
+// Sıralı aday ürünler (satış/hacim oranına göre azalan) ve önek toplamları
+struct Problem {
+    int m = 0;
+    int cap = 0;
+    int k = 0;                       // aday sayısı
+    std::vector<int> item;           // sıralı aday -> orijinal indeks
+    std::vector<int> w, p;           // sıralı hacim / satış
+    std::vector<long long> W, P;     // önek toplamları (k + 1)
+    std::vector<int> suffixMinW;     // [j, k) aralığında en küçük hacim (k + 1)
+};
+
+// Arama düğümü: görev olarak kopyalanabilir, DFS içinde yerinde değişir
+struct Node {
+    int depth = 0;
+    long long value = 0;
+    std::vector<int> residual;                  // raf başına kalan kapasite
+    std::vector<int> assign;                    // sıralı aday -> raf / -1 ([0, depth) geçerli)
+    std::vector<std::pair<int, int>> excluded;  // dışarıda bırakılan (w, p), Pareto-minimal
+};
+
+// Açık yığınlı DFS çerçevesi (derin aramada özyineleme taşmasın diye)
+struct Frame {
+    int j = 0;
+    int lastRes = -1;        // denenen en büyük kalan kapasite (eşitler özdeş)
+    int applied = -2;        // -2: çocuk yok, -1: dışarıda, s: rafa
+    bool pushedExcl = false;
+    bool dominated = false;
+    int phase = 0;           // 0: raflar, 1: dışarıda bırak, 2: bitti
+};
+
+class Search {
+public:
+    Search(const Problem& pr, const BranchAndBoundOptions& opt, WorkStealingPool& pool,
+           long long initialBest, std::vector<int> initialAssign)
+        : pr(pr), opt(opt), pool(pool), best(initialBest), bestAssign(std::move(initialAssign)) {
+        deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(0, opt.timeLimitMs));
+    }
+
+    long long bound(int j, long long value, const std::vector<int>& residual) const {
+        // Vekil kapasite: kalan en küçük ürünü bile almayan raflar sayılmaz
+        const int minW = pr.suffixMinW[j];
+        long long R = 0;
+        for (int r : residual)
+            if (r >= minW) R += r;
+
+        const long long* W = pr.W.data();
+        const long long base = W[j];
+        const long long* hi = std::upper_bound(W + j, W + pr.k + 1, base + R);
+        const int t = (int)(hi - W) - 1;
+
+        long long ub = value + pr.P[t] - pr.P[j];
+        if (t < pr.k) ub += (R - (W[t] - base)) * pr.p[t] / pr.w[t];
+        return ub;
+    }
+
+    void runTask(Node node) {
+        std::vector<Frame> frames;
+        long long localNodes = 0;
+        dfs(node, frames, localNodes);
+        nodes.fetch_add(localNodes & 1023, std::memory_order_relaxed);
+    }
+
+    long long bestValue() const { return best.load(); }
+    std::vector<int> bestAssignment() {
+        std::lock_guard<std::mutex> g(bestLock);
+        return bestAssign;
+    }
+    long long nodeCount() const { return nodes.load(); }
+    bool wasAborted() const { return aborted.load(); }
+
+private:
+    // Düğüme gir: budanırsa false, aksi halde çerçeve eklenir
+    bool enter(Node& nd, std::vector<Frame>& frames, long long& localNodes) {
+        if ((++localNodes & 1023) == 0) {
+            const long long total = nodes.fetch_add(1024, std::memory_order_relaxed) + 1024;
+            if (total >= opt.nodeLimit || std::chrono::steady_clock::now() >= deadline
+                || (opt.cancel && opt.cancel->load(std::memory_order_relaxed)))
+                aborted.store(true, std::memory_order_relaxed);
+        }
+        if (aborted.load(std::memory_order_relaxed)) return false;
+
+        // Her önek uygun bir çözümdür (kalanlar dışarıda)
+        if (nd.value > best.load(std::memory_order_relaxed)) publish(nd);
+
+        const int j = nd.depth;
+        if (j == pr.k) return false;
+        if (bound(j, nd.value, nd.residual) <= best.load(std::memory_order_relaxed)) return false;
+
+        Frame f;
+        f.j = j;
+        const int w = pr.w[j], p = pr.p[j];
+        for (const auto& e : nd.excluded) {
+            if (e.first <= w && e.second >= p) { f.dominated = true; break; }
+        }
+        if (f.dominated) f.phase = 1;
+        frames.push_back(f);
+        return true;
+    }
+
+    void publish(const Node& nd) {
+        std::lock_guard<std::mutex> g(bestLock);
+        if (nd.value <= best.load()) return;
+        best.store(nd.value);
+        bestAssign.assign(pr.k, -1);
+        std::copy(nd.assign.begin(), nd.assign.begin() + nd.depth, bestAssign.begin());
+    }
+
+    void undo(Node& nd, Frame& f) {
+        const int j = f.j;
+        if (f.applied >= 0) {
+            nd.residual[f.applied] += pr.w[j];
+            nd.value -= pr.p[j];
+        } else if (f.applied == -1 && f.pushedExcl) {
+            nd.excluded.pop_back();
+        }
+        nd.assign[j] = -1;
+        nd.depth = j;
+        f.applied = -2;
+        f.pushedExcl = false;
+    }
+
+    // Sıradaki çocuğu uygula; kalmadıysa false
+    bool nextChild(Node& nd, Frame& f) {
+        const int j = f.j;
+        const int w = pr.w[j], p = pr.p[j];
+
+        if (f.phase == 0) {
+            // Kalan kapasitesi lastRes'ten büyük, en küçük uygun raf (best-fit sırası)
+            int pick = -1;
+            for (int s = 0; s < pr.m; ++s) {
+                const int r = nd.residual[s];
+                if (r < w || r <= f.lastRes) continue;
+                if (pick < 0 || r < nd.residual[pick]) pick = s;
+            }
+            if (pick >= 0) {
+                f.lastRes = nd.residual[pick];
+                nd.residual[pick] -= w;
+                nd.value += p;
+                nd.assign[j] = pick;
+                nd.depth = j + 1;
+                f.applied = pick;
+                return true;
+            }
+            f.phase = 1;
+        }
+
+        if (f.phase == 1) {
+            f.phase = 2;
+            bool redundant = false;
+            for (const auto& e : nd.excluded) {
+                if (e.first <= w && e.second >= p) { redundant = true; break; }
+            }
+            if (!redundant) nd.excluded.emplace_back(w, p);
+            f.pushedExcl = !redundant;
+            nd.assign[j] = -1;
+            nd.depth = j + 1;
+            f.applied = -1;
+            return true;
+        }
+        return false;
+    }
+
+    void dfs(Node& nd, std::vector<Frame>& frames, long long& localNodes) {
+        const size_t base = frames.size();
+        if (!enter(nd, frames, localNodes)) return;
+
+        while (frames.size() > base) {
+            Frame& f = frames.back();
+            if (f.applied != -2) undo(nd, f);
+
+            if (aborted.load(std::memory_order_relaxed) || !nextChild(nd, f)) {
+                frames.pop_back();
+                continue;
+            }
+
+            // Boşta işçi varken ve alt ağaç yeterince büyükken görev olarak böl;
+            // kuyruk işçi sayısını aşmasın (aksi halde düğüm kopyaları birikir)
+            if (pool.idleCount() > 0 && pool.pendingCount() <= pool.threadCount()
+                && pr.k - nd.depth > kMinSplitDepth) {
+                Node child = nd;
+                pool.submit([this, child]() mutable { runTask(std::move(child)); });
+                continue;   // undo bir sonraki turda
+            }
+
+            enter(nd, frames, localNodes);
+        }
+    }
+
+    static constexpr int kMinSplitDepth = 16;
+
+    const Problem& pr;
+    const BranchAndBoundOptions& opt;
+    WorkStealingPool& pool;
+    std::chrono::steady_clock::time_point deadline;
+
+    std::atomic<long long> best;
+    std::mutex bestLock;
+    std::vector<int> bestAssign;    // sıralı aday -> raf / -1
+
+    std::atomic<long long> nodes{0};
+    std::atomic<bool> aborted{false};
+};
+
+}
+
+MultiKnapsackBB::Result MultiKnapsackBB::solve(const int* volume, const int* sales, int n,
+                                               int shelfCount, int shelfCap,
+                                               const std::vector<int>& initialShelfOf,
+                                               const BranchAndBoundOptions& options) {
+    Result out;
+    out.shelfOf.assign(std::max(0, n), -1);
+    if (n <= 0 || shelfCount <= 0 || shelfCap < 0) {
+        out.provenOptimal = true;
+        return out;
+    }
+
+    // Hacmi 0 ve satışı pozitif ürünler her zaman alınır (ilk rafa)
+    Problem pr;
+    pr.m = shelfCount;
+    pr.cap = shelfCap;
+    long long fixedValue = 0;
+    for (int i = 0; i < n; ++i) {
+        if (sales[i] <= 0 || volume[i] < 0 || volume[i] > shelfCap) continue;
+        if (volume[i] == 0) {
+            out.shelfOf[i] = 0;
+            fixedValue += sales[i];
+            continue;
+        }
+        pr.item.push_back(i);
+    }
+
+    std::stable_sort(pr.item.begin(), pr.item.end(), [&](int a, int b) {
+        const long long l = (long long)sales[a] * volume[b];
+        const long long r = (long long)sales[b] * volume[a];
+        if (l != r) return l > r;
+        return sales[a] > sales[b];
+    });
+
+    pr.k = (int)pr.item.size();
+    pr.w.resize(pr.k);
+    pr.p.resize(pr.k);
+    pr.W.assign(pr.k + 1, 0);
+    pr.P.assign(pr.k + 1, 0);
+    pr.suffixMinW.assign(pr.k + 1, shelfCap + 1);
+    for (int j = 0; j < pr.k; ++j) {
+        pr.w[j] = volume[pr.item[j]];
+        pr.p[j] = sales[pr.item[j]];
+        pr.W[j + 1] = pr.W[j] + pr.w[j];
+        pr.P[j + 1] = pr.P[j] + pr.p[j];
+    }
+    for (int j = pr.k - 1; j >= 0; --j)
+        pr.suffixMinW[j] = std::min(pr.suffixMinW[j + 1], pr.w[j]);
+
+    // Başlangıç çözümü sıralı aday düzenine çevrilir
+    std::vector<int> initAssign(pr.k, -1);
+    long long initValue = 0;
+    if ((int)initialShelfOf.size() == n) {
+        for (int j = 0; j < pr.k; ++j) {
+            const int s = initialShelfOf[pr.item[j]];
+            if (s < 0 || s >= shelfCount) continue;
+            initAssign[j] = s;
+            initValue += pr.p[j];
+        }
+    }
+
+    WorkStealingPool pool(options.threads);
+    Search search(pr, options, pool, initValue, initAssign);
+
+    Node root;
+    root.residual.assign(shelfCount, shelfCap);
+    root.assign.assign(pr.k, -1);
+    const long long rootBound = search.bound(0, 0, root.residual);
+
+    pool.submit([&search, root]() mutable { search.runTask(std::move(root)); });
+    pool.wait();
+
+    const std::vector<int> bestAssign = search.bestAssignment();
+    for (int j = 0; j < pr.k; ++j)
+        out.shelfOf[pr.item[j]] = bestAssign[j];
+
+    out.value = search.bestValue() + fixedValue;
+    out.nodes = search.nodeCount();
+    out.threads = pool.threadCount();
+    out.provenOptimal = !search.wasAborted();
+    out.upperBound = out.provenOptimal ? out.value : std::max(out.value, rootBound + fixedValue);
+    return out;
+}
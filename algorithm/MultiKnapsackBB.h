@@ -0,0 +1,39 @@
+#pragma once
+#include <atomic>
+#include <vector>
+
+struct BranchAndBoundOptions {
+    int threads = 0;                  // 0: donanım iş parçacığı sayısı
+    long long nodeLimit = 50000000;   // aşılırsa en iyi bulunan döner
+    int timeLimitMs = 5000;
+    const std::atomic<bool>* cancel = nullptr;   // true olunca en iyi bulunanla döner
+};
+
+// Özdeş kapasiteli raflar için çoklu knapsack (MKP), dal-sınır ile kesin çözüm.
+// - Ürünler satış/hacim oranına göre azalan sırada dallanır: her ürün bir
+//   rafa atanır ya da dışarıda bırakılır.
+// - Üst sınır (Martello–Toth U1): raflar tek bir vekil (surrogate) knapsack'te
+//   birleştirilir, kalan ürünlerin LP gevşetmesi önek toplamı + ikili aramayla
+//   O(log n) hesaplanır.
+// - Baskınlık: kalan kapasitesi eşit raflar özdeştir, yalnızca biri denenir;
+//   dışarıda bırakılan (w, p) ürünü varken w' >= w, p' <= p olan sonraki bir
+//   ürün rafa alınmaz.
+// - Arama iş çalan havuzda paralel yürür; boşta işçi varken sığ düğümler
+//   görev olarak bölünür. En iyi değer paylaşılır ve tüm işçilerde budama yapar.
+class MultiKnapsackBB {
+public:
+    struct Result {
+        std::vector<int> shelfOf;     // ürün -> raf, -1: yerleşmedi
+        long long value = 0;          // toplam satış
+        long long upperBound = 0;     // kanıtlanmış üst sınır
+        long long nodes = 0;
+        bool provenOptimal = false;   // arama limit aşılmadan bitti
+        int threads = 1;
+    };
+
+    // initialShelfOf: başlangıç çözümü (alt sınır); boşsa sıfırdan başlar
+    static Result solve(const int* volume, const int* sales, int n,
+                        int shelfCount, int shelfCap,
+                        const std::vector<int>& initialShelfOf,
+                        const BranchAndBoundOptions& options);
+};
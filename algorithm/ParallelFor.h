@@ -0,0 +1,13 @@
+#pragma once
+#include <thread>
+#include <vector>
+
+// fn(t) çağrılarını t = 0..threads-1 için paralel çalıştır (0 çağıran iş parçacığında)
+template <typename Fn>
+inline void parallelFor(int threads, Fn fn) {
+    std::vector<std::thread> pool;
+    pool.reserve(threads > 0 ? threads - 1 : 0);
+    for (int t = 1; t < threads; ++t) pool.emplace_back(fn, t);
+    fn(0);
+    for (auto& th : pool) th.join();
+}
@@ -0,0 +1,130 @@
+#include "PlacementCache.h"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+
+inline uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+inline uint64_t mixRound(uint64_t acc, uint64_t word) {
+    acc += word * kPrime2;
+    return rotl(acc, 31) * kPrime1;
+}
+
+inline uint64_t avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= kPrime2;
+    h ^= h >> 29;
+    h *= kPrime1;
+    h ^= h >> 32;
+    return h;
+}
+
+// 4 bağımsız şerit: çarpmalar ardışık bağımlılık zinciri oluşturmaz
+uint64_t hashInts(const int* data, int n, uint64_t seed) {
+    uint64_t lane[4] = {seed + kPrime1, seed ^ kPrime2, seed, seed - kPrime1};
+
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w[4];
+        std::memcpy(w, data + i, sizeof(w));
+        lane[0] = mixRound(lane[0], w[0]);
+        lane[1] = mixRound(lane[1], w[1]);
+        lane[2] = mixRound(lane[2], w[2]);
+        lane[3] = mixRound(lane[3], w[3]);
+    }
+    uint64_t h = rotl(lane[0], 1) + rotl(lane[1], 7) + rotl(lane[2], 12) + rotl(lane[3], 18);
+    for (; i < n; ++i) h = mixRound(h, (uint32_t)data[i]);
+    return avalanche(h ^ (uint64_t)n);
+}
+
+long long layoutBytes(const ShelfLayout& l) {
+    return (long long)(l.capacity.size() + l.used.size() + l.offsets.size() + l.items.size()) * sizeof(int);
+}
+
+}
+
+uint64_t PlacementCache::fingerprint(const ProductCatalog& catalog) {
+    const int n = catalog.size();
+    const uint64_t h = hashInts(catalog.salesData(), n, 0x5A1E5ULL);
+    return avalanche(h ^ rotl(hashInts(catalog.volumeData(), n, h), 17));
+}
+
+size_t PlacementCache::KeyHash::operator()(const PlacementCacheKey& k) const {
+    uint64_t h = mixRound(k.catalog, ((uint64_t)(uint32_t)k.shelfCount << 32) | (uint32_t)k.shelfCap);
+    h = mixRound(h, k.param ^ ((uint64_t)k.algo << 56));
+    h = mixRound(h, (uint32_t)k.catalogSize);
+    return (size_t)avalanche(h);
+}
+
+// -------------------- LRU
+const PlacementCache::Value* PlacementCache::find(const PlacementCacheKey& key) {
+    auto it = map.find(key);
+    if (it == map.end()) {
+        ++st.misses;
+        return nullptr;
+    }
+    ++st.hits;
+    lru.splice(lru.begin(), lru, it->second);
+    return &it->second->value;
+}
+
+void PlacementCache::insert(const PlacementCacheKey& key, Value value) {
+    const long long bytes = bytesOf(value);
+
+    auto old = map.find(key);
+    if (old != map.end()) {
+        st.bytes -= old->second->bytes;
+        lru.erase(old->second);
+        map.erase(old);
+    }
+    if (bytes > budget) {
+        st.entries = (int)map.size();
+        return;
+    }
+
+    lru.push_front(Entry{key, std::move(value), bytes});
+    map.emplace(key, lru.begin());
+    st.bytes += bytes;
+    evictToBudget();
+    st.entries = (int)map.size();
+}
+
+void PlacementCache::evictToBudget() {
+    while (st.bytes > budget && !lru.empty()) {
+        const Entry& e = lru.back();
+        st.bytes -= e.bytes;
+        map.erase(e.key);
+        lru.pop_back();
+        ++st.evictions;
+    }
+}
+
+void PlacementCache::setMemoryBudget(long long bytes) {
+    budget = bytes;
+    evictToBudget();
+    st.entries = (int)map.size();
+}
+
+void PlacementCache::clear() {
+    lru.clear();
+    map.clear();
+    st.bytes = 0;
+    st.entries = 0;
+}
+
+long long PlacementCache::bytesOf(const Value& value) {
+    struct Visitor {
+        long long operator()(const PlacementResult& r) const { return layoutBytes(r.layout); }
+        long long operator()(const DPKnapsackResult& r) const {
+            return layoutBytes(r.placement.layout)
+                   + (long long)(r.dpLastRow.size() + r.chosenForFirstShelf.size()) * sizeof(int);
+        }
+        long long operator()(const ExactPlacementResult& r) const { return layoutBytes(r.placement.layout); }
+        long long operator()(const ApproxPlacementResult& r) const { return layoutBytes(r.placement.layout); }
+    };
+    return (long long)sizeof(Entry) + std::visit(Visitor(), value);
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+#include "WarehouseAlgorithms.h"
+
+enum class PlacementAlgo : uint8_t {
+    Static,
+    Greedy,
+    BestFit,
+    DP,
+    DPVolumeClasses,
+    DPParallel,
+    Approx,
+    Exact
+};
+
+struct PlacementCacheKey {
+    uint64_t catalog = 0;         // PlacementCache::fingerprint
+    int catalogSize = 0;          // özet çakışmasına karşı ürün sayısı da karşılaştırılır
+    PlacementAlgo algo = PlacementAlgo::Static;
+    int shelfCount = 0;
+    int shelfCap = 0;
+    uint64_t param = 0;           // algoritmaya özgü ayar (ε bitleri, süre sınırı...)
+
+    bool operator==(const PlacementCacheKey& o) const {
+        return catalog == o.catalog && catalogSize == o.catalogSize
+               && algo == o.algo && shelfCount == o.shelfCount
+               && shelfCap == o.shelfCap && param == o.param;
+    }
+};
+
+struct PlacementCacheStats {
+    long long hits = 0;
+    long long misses = 0;
+    long long evictions = 0;
+    int entries = 0;
+    long long bytes = 0;          // tahmini (düzen dizileri + sonuç yapısı)
+};
+
+// Yerleşim sonuçları için LRU önbellek.
+// Anahtar: katalog içeriğinin parmak izi ve ürün sayısı + (algoritma, raf sayısı,
+// kapasite, ayar).
+// Yerleşim yalnızca satış / hacim sütunlarına bağlı olduğundan parmak izi
+// isimleri kapsamaz. Toplam boyut bütçeyi aşınca en eski kullanılan atılır;
+// bütçeden büyük tek sonuç saklanmaz.
+class PlacementCache {
+public:
+    using Value = std::variant<PlacementResult, DPKnapsackResult, ExactPlacementResult, ApproxPlacementResult>;
+
+    explicit PlacementCache(long long memoryBudgetBytes = 256LL << 20) : budget(memoryBudgetBytes) {}
+
+    // Satış ve hacim sütunlarının 64 bit özeti, O(n)
+    static uint64_t fingerprint(const ProductCatalog& catalog);
+
+    // Varsa kopyayı out'a yazar ve girdiyi LRU başına taşır
+    template <typename R>
+    bool lookup(const PlacementCacheKey& key, R& out) {
+        const Value* v = find(key);
+        if (!v || !std::holds_alternative<R>(*v)) return false;
+        out = std::get<R>(*v);
+        return true;
+    }
+
+    template <typename R>
+    void store(const PlacementCacheKey& key, const R& result) {
+        insert(key, Value(result));
+    }
+
+    // hit verilirse önbellekten gelip gelmediği yazılır
+    template <typename R, typename Fn>
+    R getOrCompute(const PlacementCacheKey& key, Fn compute, bool* hit = nullptr) {
+        R out;
+        const bool found = lookup(key, out);
+        if (hit) *hit = found;
+        if (found) return out;
+        out = compute();
+        store(key, out);
+        return out;
+    }
+
+    void setMemoryBudget(long long bytes);
+    long long memoryBudget() const { return budget; }
+
+    void clear();
+    const PlacementCacheStats& stats() const { return st; }
+
+private:
+    struct KeyHash {
+        size_t operator()(const PlacementCacheKey& k) const;
+    };
+    struct Entry {
+        PlacementCacheKey key;
+        Value value;
+        long long bytes = 0;
+    };
+
+    const Value* find(const PlacementCacheKey& key);
+    void insert(const PlacementCacheKey& key, Value value);
+    void evictToBudget();
+    static long long bytesOf(const Value& value);
+
+    long long budget;
+    std::list<Entry> lru;   // baş: en son kullanılan
+    std::unordered_map<PlacementCacheKey, std::list<Entry>::iterator, KeyHash> map;
+    PlacementCacheStats st;
+};
@@ -0,0 +1,309 @@
+#include "PlacementEngine.h"
+#include "LocalSearch.h"
+#include "ProductLocationIndex.h"
+#include "PlacementProfile.h"
+
+#include <algorithm>
+
+PlacementEngine::PlacementEngine(ProductCatalog catalog, int shelfCount, int shelfCap,
+                                 const ShelfLayout& initial, const PlacementEngineOptions& options)
+    : opt(options), cat(std::move(catalog)), shelves(std::max(0, shelfCount)), capacity(std::max(0, shelfCap)) {
+    assignFrom(initial);
+
+    // Başlangıç yerleşimi yoksa havuzdan best-fit
+    if (initial.itemCount() == 0) {
+        std::vector<std::pair<int, int>> order(pool.begin(), pool.end());
+        for (const auto& e : order) {
+            const int s = bestFitShelf(cat.volume(e.second));
+            if (s < 0) continue;
+            removeFromPool(e.second);
+            place(e.second, s);
+        }
+    }
+    bestEfficiency = efficiency();
+}
+
+double PlacementEngine::efficiency() const {
+    const long long total = capacityVolume();
+    return total > 0 ? (double)usedTotal / total * 100.0 : 0.0;
+}
+
+// -------------------- durum
+void PlacementEngine::assignFrom(const ShelfLayout& layout) {
+    const int n = cat.size();
+    state.assign(n, kPool);
+    pos.assign(n, -1);
+    members.assign(shelves, {});
+    used.assign(shelves, 0);
+    byResidual.clear();
+    pool.clear();
+    usedTotal = 0;
+    salesTotal = 0;
+    placed = 0;
+
+    // Çıkarılmış işaretleri (varsa) çağıran geri yazar
+    live = 0;
+    for (int s = 0; s < std::min(shelves, layout.shelfCount()); ++s)
+        for (int k = layout.offsets[s]; k < layout.offsets[s + 1]; ++k)
+            state[layout.items[k]] = s;
+
+    for (int s = 0; s < shelves; ++s) byResidual.insert({capacity, s});
+    for (int i = 0; i < n; ++i) {
+        const int s = state[i];
+        state[i] = kPool;
+        ++live;
+        if (s >= 0) place(i, s);
+        else {
+            addToPool(i);
+            if (index) index->unplace(i);
+        }
+    }
+}
+
+void PlacementEngine::place(int item, int shelf) {
+    const int w = cat.volume(item);
+    byResidual.erase({capacity - used[shelf], shelf});
+    used[shelf] += w;
+    byResidual.insert({capacity - used[shelf], shelf});
+
+    state[item] = shelf;
+    pos[item] = (int)members[shelf].size();
+    members[shelf].push_back(item);
+    usedTotal += w;
+    salesTotal += cat.sales(item);
+    ++placed;
+    if (index) index->place(item, shelf, pos[item]);
+}
+
+void PlacementEngine::unplace(int item) {
+    const int shelf = state[item];
+    const int w = cat.volume(item);
+    byResidual.erase({capacity - used[shelf], shelf});
+    used[shelf] -= w;
+    byResidual.insert({capacity - used[shelf], shelf});
+
+    std::vector<int>& mem = members[shelf];
+    const int p = pos[item];
+    mem[p] = mem.back();
+    pos[mem[p]] = p;
+    mem.pop_back();
+
+    state[item] = kPool;
+    pos[item] = -1;
+    usedTotal -= w;
+    salesTotal -= cat.sales(item);
+    --placed;
+    if (index) {
+        // Son ürün boşalan sıraya taşındı
+        if (p < (int)mem.size()) index->place(mem[p], shelf, p);
+        index->unplace(item);
+    }
+}
+
+void PlacementEngine::addToPool(int item) {
+    const int w = cat.volume(item);
+    if (w >= 0 && w <= capacity) pool.insert({-cat.sales(item), item});
+}
+
+void PlacementEngine::removeFromPool(int item) {
+    pool.erase({-cat.sales(item), item});
+}
+
+// Hacmi sığan en az boşluklu raf, yoksa -1
+int PlacementEngine::bestFitShelf(int volume) const {
+    if (volume < 0) return -1;
+    auto it = byResidual.lower_bound({volume, -1});
+    return it == byResidual.end() ? -1 : it->second;
+}
+
+// Havuzun en çok satanlarından sığanlar (sınırlı tarama)
+void PlacementEngine::fillGap(int shelf) {
+    int scanned = 0;
+    for (auto it = pool.begin(); it != pool.end() && scanned < opt.fillScanLimit; ++scanned) {
+        const int item = it->second;
+        if (cat.volume(item) > capacity - used[shelf]) { ++it; continue; }
+        it = pool.erase(it);
+        place(item, shelf);
+        ++st.gapFills;
+        if (used[shelf] == capacity) break;
+    }
+}
+
+// -------------------- işlemler
+int PlacementEngine::insert(QStringView name, int sales, int volume) {
+    const int item = cat.add(name, sales, volume);
+    if (index) index->insert(name, item);
+    state.push_back(kPool);
+    pos.push_back(-1);
+    ++live;
+    ++st.inserts;
+
+    const int s = bestFitShelf(volume);
+    if (s >= 0) {
+        place(item, s);
+        ++st.placedOnArrival;
+    } else {
+        addToPool(item);
+    }
+    afterOp();
+    return item;
+}
+
+bool PlacementEngine::remove(int item) {
+    if (item < 0 || item >= cat.size() || state[item] == kRemoved) return false;
+
+    const int s = state[item];
+    if (s >= 0) unplace(item);
+    else removeFromPool(item);
+    state[item] = kRemoved;
+    --live;
+    ++st.removals;
+    if (index) index->erase(cat.name(item), item);
+
+    if (s >= 0) fillGap(s);
+    afterOp();
+    return true;
+}
+
+bool PlacementEngine::updateSales(int item, int sales) {
+    if (item < 0 || item >= cat.size() || state[item] == kRemoved) return false;
+    ++st.salesUpdates;
+
+    const int s = state[item];
+    const int old = cat.sales(item);
+    if (s < 0) {
+        removeFromPool(item);
+        cat.setSales(item, sales);
+        addToPool(item);
+        afterOp();
+        return true;
+    }
+
+    cat.setSales(item, sales);
+    salesTotal += (long long)sales - old;
+
+    // Satışı düşen ürün: boşluğuyla birlikte sığan daha çok satan havuz ürünüyle takas
+    if (sales < old) {
+        const int space = capacity - used[s] + cat.volume(item);
+        int scanned = 0;
+        for (auto it = pool.begin(); it != pool.end() && scanned < opt.fillScanLimit; ++it, ++scanned) {
+            const int cand = it->second;
+            if (cat.sales(cand) <= sales) break;
+            if (cat.volume(cand) > space) continue;
+            pool.erase(it);
+            unplace(item);
+            addToPool(item);
+            place(cand, s);
+            ++st.swaps;
+            fillGap(s);
+            break;
+        }
+    }
+    afterOp();
+    return true;
+}
+
+// -------------------- kalite eşiği
+void PlacementEngine::afterOp() {
+    ++opsSinceReoptimize;
+    const double eff = efficiency();
+    bestEfficiency = std::max(bestEfficiency, eff);
+
+    if (opsSinceReoptimize < opt.cooldownOps || pool.empty()) return;
+    if (eff >= opt.qualityThreshold * bestEfficiency) return;
+    reoptimize();
+}
+
+void PlacementEngine::reoptimize() {
+    const long long t0 = steadyNowNs();
+
+    // Alt problem: en boş raflar + havuzun en çok satanları (yerel indekslerle)
+    std::vector<int> subShelves, items;
+    for (auto it = byResidual.rbegin(); it != byResidual.rend()
+                                        && (int)subShelves.size() < opt.reoptimizeShelves; ++it)
+        subShelves.push_back(it->second);
+
+    ProductCatalog sub;
+    ShelfLayoutBuilder start;
+    start.reset((int)subShelves.size(), capacity);
+    for (int k = 0; k < (int)subShelves.size(); ++k) {
+        for (int item : members[subShelves[k]]) {
+            start.place(k, sub.add(QStringView(), cat.sales(item), cat.volume(item)), cat.volume(item));
+            items.push_back(item);
+        }
+    }
+    int taken = 0;
+    for (auto it = pool.begin(); it != pool.end() && taken < opt.reoptimizePoolItems; ++it, ++taken) {
+        sub.add(QStringView(), cat.sales(it->second), cat.volume(it->second));
+        items.push_back(it->second);
+    }
+
+    LocalSearchOptions ls;
+    ls.timeBudgetMs = opt.reoptimizeBudgetMs;
+    ls.objective = LocalSearchObjective::Fill;
+    ls.seed = (uint64_t)st.reoptimizations + 1;
+    const ShelfLayout improved = LocalSearch::improve(start.finish(), sub, ls);
+
+    // Fark: önce yeri değişenler çıkarılır, sonra yeni raflarına yerleştirilir
+    std::vector<int> target(items.size(), kPool);
+    for (int k = 0; k < improved.shelfCount(); ++k)
+        for (int p = improved.offsets[k]; p < improved.offsets[k + 1]; ++p)
+            target[improved.items[p]] = subShelves[k];
+    for (size_t j = 0; j < items.size(); ++j) {
+        const int item = items[j];
+        if (state[item] == target[j] || state[item] < 0) continue;
+        unplace(item);
+        addToPool(item);
+    }
+    for (size_t j = 0; j < items.size(); ++j) {
+        const int item = items[j];
+        if (target[j] < 0 || state[item] == target[j]) continue;
+        removeFromPool(item);
+        place(item, target[j]);
+    }
+
+    ++st.reoptimizations;
+    st.reoptimizeUs += (steadyNowNs() - t0) / 1000;
+    opsSinceReoptimize = 0;
+    bestEfficiency = efficiency();
+}
+
+ShelfLayout PlacementEngine::layout() const {
+    ShelfLayoutBuilder b;
+    b.reset(shelves, capacity);
+    for (int s = 0; s < shelves; ++s)
+        for (int i : members[s]) b.place(s, i, cat.volume(i));
+    return b.finish();
+}
+
+void PlacementEngine::attachIndex(ProductLocationIndex* idx) {
+    index = idx;
+    if (!index) return;
+    for (int i = 0; i < cat.size(); ++i)
+        if (state[i] < 0) index->unplace(i);
+    for (int s = 0; s < shelves; ++s)
+        for (int k = 0; k < (int)members[s].size(); ++k)
+            index->place(members[s][k], s, k);
+}
+
+ProductCatalog PlacementEngine::liveCatalog(ShelfLayout* outLayout, std::vector<int>* remap) const {
+    const int n = cat.size();
+    std::vector<int> local;
+    std::vector<int>& newIndex = remap ? *remap : local;
+    newIndex.assign(n, -1);
+    ProductCatalog out;
+    out.reserve(live);
+    for (int i = 0; i < n; ++i) {
+        if (state[i] == kRemoved) continue;
+        newIndex[i] = out.add(cat.name(i), cat.sales(i), cat.volume(i));
+    }
+
+    if (outLayout) {
+        ShelfLayoutBuilder b;
+        b.reset(shelves, capacity);
+        for (int s = 0; s < shelves; ++s)
+            for (int i : members[s]) b.place(s, newIndex[i], cat.volume(i));
+        *outLayout = b.finish();
+    }
+    return out;
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include <set>
+#include <utility>
+#include <vector>
+#include <QStringView>
+
+#include "../model/ProductCatalog.h"
+#include "../model/ShelfLayout.h"
+
+class ProductLocationIndex;
+
+struct PlacementEngineOptions {
+    double qualityThreshold = 0.97;   // doluluk, en iyi görülenin bu katının altına düşerse
+    int reoptimizeBudgetMs = 5;       // sınırlı yeniden optimizasyon (yerel arama) bütçesi
+    int reoptimizeShelves = 16;       // yeniden optimizasyona giren en boş raf sayısı
+    int reoptimizePoolItems = 512;    // ... ve havuzun en çok satanlarından alınan ürün sayısı
+    int cooldownOps = 32;             // iki yeniden optimizasyon arası en az işlem
+    int fillScanLimit = 64;           // boşluk doldururken bakılan havuz ürünü sayısı
+};
+
+struct PlacementEngineStats {
+    long long inserts = 0;
+    long long removals = 0;
+    long long salesUpdates = 0;
+    long long placedOnArrival = 0;    // gelişte doğrudan rafa giren
+    long long gapFills = 0;           // boşalan yere havuzdan yerleşen
+    long long swaps = 0;              // satışı düşen ürünün havuzdakiyle takası
+    long long reoptimizations = 0;
+    long long reoptimizeUs = 0;
+};
+
+// Sürekli ürün akışı için durumlu yerleşim.
+// insert / remove / updateSales rafları yerel olarak yamalar:
+// - gelen ürün best-fit rafa (kalan kapasite kümesi, O(log m)) ya da havuza
+// - çıkan ürünün boşluğu havuzun en çok satanlarından sınırlı taramayla dolar
+// - kullanılan hacim, satış ve doluluk toplamları her işlemde güncellenir
+// Doluluk en iyi görülen değerin qualityThreshold katının altına düşerse
+// süre bütçeli yerel arama ile yeniden optimize edilir. Arama yalnızca en boş
+// raflar ve havuzun başından kurulan alt problemde çalışır, sonuç fark olarak
+// uygulanır: maliyet katalog boyutundan bağımsızdır.
+// Çıkarılan ürünler katalogda kalır (indeksler sabit), yalnızca işaretlenir;
+// akış sonunda liveCatalog() sıkıştırılmış katalog ve yerleşimi verir.
+class PlacementEngine {
+public:
+    // initial: başlangıç yerleşimi (boşsa tüm ürünler havuzdan yerleştirilir)
+    PlacementEngine(ProductCatalog catalog, int shelfCount, int shelfCap,
+                    const ShelfLayout& initial = ShelfLayout(),
+                    const PlacementEngineOptions& options = PlacementEngineOptions());
+
+    // Yeni ürünün katalog indeksi
+    int insert(QStringView name, int sales, int volume);
+    bool remove(int item);
+    bool updateSales(int item, int sales);
+
+    // Zorla yeniden optimize et (eşik beklenmeden)
+    void reoptimize();
+
+    // Bağlı indeks her işlemde artımlı güncellenir (nullptr: bağlantıyı kes).
+    // Bağlanırken indeksin bu motorun kataloğundan kurulduğu varsayılır;
+    // raf/sıra bilgisi bir kez O(n) eşitlenir.
+    void attachIndex(ProductLocationIndex* index);
+
+    // -------------------- O(1) toplamlar
+    long long usedVolume() const { return usedTotal; }
+    long long capacityVolume() const { return (long long)shelves * capacity; }
+    long long placedSales() const { return salesTotal; }
+    double efficiency() const;
+    int liveCount() const { return live; }
+    int placedCount() const { return placed; }
+
+    int shelfCount() const { return shelves; }
+    int usedOn(int shelf) const { return used[shelf]; }
+    int shelfOf(int item) const { return item >= 0 && item < (int)state.size() ? state[item] : -1; }
+    bool isRemoved(int item) const { return item >= 0 && item < (int)state.size() && state[item] == kRemoved; }
+
+    const ProductCatalog& catalog() const { return cat; }
+    const PlacementEngineStats& stats() const { return st; }
+
+    // Anlık görüntü, O(n)
+    ShelfLayout layout() const;
+
+    // Çıkarılanlar atılmış katalog, O(n). layout verilirse yerleşim yeni
+    // indekslerle (katalog sırası korunarak yeniden numaralanmış) yazılır;
+    // remap verilirse eski -> yeni indeks (-1: çıkarıldı).
+    ProductCatalog liveCatalog(ShelfLayout* layout = nullptr, std::vector<int>* remap = nullptr) const;
+
+private:
+    static constexpr int kPool = -1;      // yerleşmemiş (havuzda ya da hiçbir rafa sığmaz)
+    static constexpr int kRemoved = -2;
+
+    void place(int item, int shelf);
+    void unplace(int item);
+    void addToPool(int item);
+    void removeFromPool(int item);
+    int bestFitShelf(int volume) const;
+    void fillGap(int shelf);
+    void afterOp();
+    void assignFrom(const ShelfLayout& layout);
+
+    PlacementEngineOptions opt;
+    PlacementEngineStats st;
+    ProductCatalog cat;
+    int shelves = 0;
+    int capacity = 0;
+
+    std::vector<int> state;                    // ürün -> raf / kPool / kRemoved
+    std::vector<int> pos;                      // ürün -> raf içi sıra
+    std::vector<std::vector<int>> members;
+    std::vector<int> used;
+    std::set<std::pair<int, int>> byResidual;  // (kalan, raf)
+    std::set<std::pair<int, int>> pool;        // (-satış, ürün); yalnızca sığabilenler
+
+    long long usedTotal = 0;
+    long long salesTotal = 0;
+    int live = 0;
+    int placed = 0;
+
+    double bestEfficiency = 0.0;
+    int opsSinceReoptimize = 0;
+
+    ProductLocationIndex* index = nullptr;
+};
@@ -0,0 +1,23 @@
+#include "PlacementProfile.h"
+
+const char* PlacementProfile::phaseName(PlacementPhase p) {
+    switch (p) {
+        case PlacementPhase::Sort:       return "sort";
+        case PlacementPhase::ShelfFill:  return "shelf_fill";
+        case PlacementPhase::DPFill:     return "dp_fill";
+        case PlacementPhase::Traceback:  return "traceback";
+        case PlacementPhase::Compaction: return "compaction";
+        case PlacementPhase::ResultCopy: return "result_copy";
+        default:                         return "?";
+    }
+}
+
+const char* PlacementProfile::counterName(PlacementCounter c) {
+    switch (c) {
+        case PlacementCounter::CellsEvaluated: return "cells_evaluated";
+        case PlacementCounter::ItemsScanned:   return "items_scanned";
+        case PlacementCounter::ItemsPlaced:    return "items_placed";
+        case PlacementCounter::NodesExplored:  return "nodes_explored";
+        default:                               return "?";
+    }
+}
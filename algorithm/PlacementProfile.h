@@ -0,0 +1,78 @@
+#pragma once
+#include <chrono>
+
+// Yerleşim sırasında ölçülen fazlar. Aynı faz birden çok kez girilirse
+// (ör. raf başına DP doldurma) süreler toplanır.
+enum class PlacementPhase : int {
+    Sort,         // sıralama / permütasyon
+    ShelfFill,    // raflara atama
+    DPFill,       // DP satır güncellemeleri
+    Traceback,    // seçilenlerin geri izlenmesi
+    Compaction,   // seçilenlerin düşülmesi (maske / sınıf başı)
+    ResultCopy,   // düz yerleşim ve sonuç kopyaları
+    Count
+};
+
+enum class PlacementCounter : int {
+    CellsEvaluated,   // DP hücre güncellemesi
+    ItemsScanned,     // gezilen ürün
+    ItemsPlaced,      // rafa yerleşen ürün
+    NodesExplored,    // dal-sınır arama düğümü
+    Count
+};
+
+// steady_clock, ns
+inline long long steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+struct PlacementProfile {
+    static constexpr int kPhaseCount   = (int)PlacementPhase::Count;
+    static constexpr int kCounterCount = (int)PlacementCounter::Count;
+
+    long long totalNs = 0;
+    long long phaseNs[kPhaseCount] = {};
+    long long counters[kCounterCount] = {};
+
+    long long phase(PlacementPhase p) const { return phaseNs[(int)p]; }
+    long long counter(PlacementCounter c) const { return counters[(int)c]; }
+
+    void addPhase(PlacementPhase p, long long ns) { phaseNs[(int)p] += ns; }
+    void count(PlacementCounter c, long long n = 1) { counters[(int)c] += n; }
+
+    // Kısa, ASCII isimler (JSON / CSV anahtarı olarak da kullanılır)
+    static const char* phaseName(PlacementPhase p);
+    static const char* counterName(PlacementCounter c);
+};
+
+// Kapsam boyunca geçen süreyi ilgili faza ekler; profile == nullptr ise hiçbir şey yapmaz
+class ScopedPhase {
+public:
+    ScopedPhase(PlacementProfile* profile, PlacementPhase phase)
+        : prof(profile), ph(phase), t0(profile ? steadyNowNs() : 0) {}
+    ~ScopedPhase() {
+        if (prof) prof->addPhase(ph, steadyNowNs() - t0);
+    }
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+private:
+    PlacementProfile* prof;
+    PlacementPhase ph;
+    long long t0;
+};
+
+// Toplam süre için tek başlangıç noktası
+class Stopwatch {
+public:
+    Stopwatch() : t0(steadyNowNs()) {}
+
+    long long elapsedNs() const { return steadyNowNs() - t0; }
+    long long elapsedUs() const { return elapsedNs() / 1000; }
+
+private:
+    long long t0;
+};
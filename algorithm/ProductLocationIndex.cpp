@@ -0,0 +1,106 @@
+#include "ProductLocationIndex.h"
+
+#include <algorithm>
+
+// -------------------- build
+void ProductLocationIndex::buildCatalog(const ProductCatalog& catalog) {
+    byName.clear();
+    byName.reserve(catalog.size());
+    for (int i = 0; i < catalog.size(); ++i) {
+        // Aynı isim birden fazlaysa ilk kayıt kalır
+        QString key = catalog.name(i).toString().toCaseFolded();
+        if (!byName.contains(key))
+            byName.insert(key, i);
+    }
+    shelfOf.assign(catalog.size(), -1);
+    slotOf.assign(catalog.size(), -1);
+}
+
+void ProductLocationIndex::assignPlacement(const ShelfLayout& layout) {
+    std::fill(shelfOf.begin(), shelfOf.end(), -1);
+    std::fill(slotOf.begin(), slotOf.end(), -1);
+
+    for (int s = 0; s < layout.shelfCount(); ++s) {
+        const Shelf shelf = layout.shelf(s);
+        for (int k = 0; k < shelf.count; ++k)
+            place(shelf.items[k], s, k);
+    }
+}
+
+void ProductLocationIndex::clear() {
+    byName.clear();
+    shelfOf.clear();
+    slotOf.clear();
+}
+
+// -------------------- lookup
+ProductLocation ProductLocationIndex::at(int catalogIndex) const {
+    ProductLocation loc;
+    if (catalogIndex < 0) return loc;
+    loc.catalogIndex = catalogIndex;
+    if (catalogIndex < (int)shelfOf.size()) {
+        loc.shelf = shelfOf[catalogIndex];
+        loc.slot  = slotOf[catalogIndex];
+    }
+    return loc;
+}
+
+ProductLocation ProductLocationIndex::find(const QString& name) const {
+    return at(byName.value(name.toCaseFolded(), -1));
+}
+
+// -------------------- incremental
+void ProductLocationIndex::ensureSlot(int catalogIndex) {
+    if (catalogIndex >= (int)shelfOf.size()) {
+        shelfOf.resize(catalogIndex + 1, -1);
+        slotOf.resize(catalogIndex + 1, -1);
+    }
+}
+
+void ProductLocationIndex::insert(QStringView name, int catalogIndex) {
+    // buildCatalog ile aynı kural: aynı isim varsa ilk kayıt kalır
+    const QString key = name.toString().toCaseFolded();
+    if (!byName.contains(key)) byName.insert(key, catalogIndex);
+    ensureSlot(catalogIndex);
+}
+
+void ProductLocationIndex::erase(QStringView name, int catalogIndex) {
+    unplace(catalogIndex);
+    const QString key = name.toString().toCaseFolded();
+    auto it = byName.find(key);
+    if (it != byName.end() && it.value() == catalogIndex) byName.erase(it);
+}
+
+void ProductLocationIndex::place(int catalogIndex, int shelf, int slot) {
+    ensureSlot(catalogIndex);
+    shelfOf[catalogIndex] = shelf;
+    slotOf[catalogIndex]  = slot;
+}
+
+void ProductLocationIndex::unplace(int catalogIndex) {
+    if (catalogIndex < 0 || catalogIndex >= (int)shelfOf.size()) return;
+    shelfOf[catalogIndex] = -1;
+    slotOf[catalogIndex]  = -1;
+}
+
+void ProductLocationIndex::remap(const std::vector<int>& newIndex) {
+    for (auto it = byName.begin(); it != byName.end();) {
+        const int old = it.value();
+        const int idx = old < (int)newIndex.size() ? newIndex[old] : -1;
+        if (idx < 0) { it = byName.erase(it); continue; }
+        it.value() = idx;
+        ++it;
+    }
+
+    int count = 0;
+    for (int idx : newIndex) count = std::max(count, idx + 1);
+    std::vector<int> shelves(count, -1), slots(count, -1);
+    for (int old = 0; old < (int)newIndex.size() && old < (int)shelfOf.size(); ++old) {
+        const int idx = newIndex[old];
+        if (idx < 0) continue;
+        shelves[idx] = shelfOf[old];
+        slots[idx] = slotOf[old];
+    }
+    shelfOf.swap(shelves);
+    slotOf.swap(slots);
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <vector>
+#include <QHash>
+#include <QString>
+
+#include "../model/ProductCatalog.h"
+#include "../model/ShelfLayout.h"
+
+// Ürünün katalogdaki ve depodaki yeri
+struct ProductLocation {
+    int catalogIndex = -1;   // bulunamadıysa -1
+    int shelf = -1;          // yerleşmemişse -1
+    int slot = -1;           // raftaki sıra
+};
+
+// Katlanmış isim -> katalog indeksi (hash), katalog indeksi -> (raf, sıra) (dizi).
+// Arama O(1). Tam yerleşim assignPlacement ile işlenir; PlacementEngine'e
+// bağlanınca her ekleme / çıkarma / taşıma artımlı yansıtılır.
+class ProductLocationIndex {
+public:
+    // Katalog kısmını kur (yerleşim bilgisi sıfırlanır)
+    void buildCatalog(const ProductCatalog& catalog);
+
+    // Yeni yerleşimi işle: önceki raf/sıra bilgisi temizlenir
+    void assignPlacement(const ShelfLayout& layout);
+
+    ProductLocation find(const QString& name) const;
+    ProductLocation at(int catalogIndex) const;
+
+    // Artımlı güncellemeler
+    void insert(QStringView name, int catalogIndex);
+    // İsim yalnızca bu indekse işaret ediyorsa silinir (aynı isimli başka ürün kalır)
+    void erase(QStringView name, int catalogIndex);
+    void place(int catalogIndex, int shelf, int slot);
+    void unplace(int catalogIndex);
+
+    // Katalog sıkıştırıldı: eski -> yeni indeks (-1: atıldı). O(n), isimler yeniden katlanmaz
+    void remap(const std::vector<int>& newIndex);
+
+    int size() const { return (int)byName.size(); }
+    void clear();
+
+private:
+    void ensureSlot(int catalogIndex);
+
+    QHash<QString, int> byName;
+    std::vector<int> shelfOf;
+    std::vector<int> slotOf;
+};
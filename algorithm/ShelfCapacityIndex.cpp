@@ -0,0 +1,56 @@
+#include "ShelfCapacityIndex.h"
+
+#include <algorithm>
+#include <climits>
+
+// -------------------- ShelfCapacityIndex
+void ShelfCapacityIndex::reset(int shelfCount, int capacity) {
+    shelves = std::max(0, shelfCount);
+    leaves = 1;
+    while (leaves < shelves) leaves <<= 1;
+
+    // Boş yapraklar hiçbir sorguya cevap vermesin
+    tree.assign(2 * (size_t)leaves, INT_MIN);
+    for (int i = 0; i < shelves; ++i) tree[leaves + i] = capacity;
+    for (int i = leaves - 1; i >= 1; --i) tree[i] = std::max(tree[2 * i], tree[2 * i + 1]);
+}
+
+int ShelfCapacityIndex::firstFit(int volume, int from) const {
+    if (shelves == 0 || from >= shelves) return -1;
+    return descend(1, 0, leaves - 1, volume, std::max(0, from));
+}
+
+int ShelfCapacityIndex::descend(int node, int lo, int hi, int volume, int from) const {
+    if (hi < from || tree[node] < volume) return -1;
+    if (lo == hi) return lo;
+
+    int mid = (lo + hi) / 2;
+    int r = descend(2 * node, lo, mid, volume, from);
+    if (r >= 0) return r;
+    return descend(2 * node + 1, mid + 1, hi, volume, from);
+}
+
+void ShelfCapacityIndex::consume(int shelf, int volume) {
+    int i = leaves + shelf;
+    tree[i] -= volume;
+    for (i >>= 1; i >= 1; i >>= 1)
+        tree[i] = std::max(tree[2 * i], tree[2 * i + 1]);
+}
+
+// -------------------- BestFitIndex
+void BestFitIndex::reset(int shelfCount, int capacity) {
+    rem.assign(std::max(0, shelfCount), capacity);
+    byRemaining.clear();
+    for (int i = 0; i < (int)rem.size(); ++i) byRemaining.emplace(capacity, i);
+}
+
+int BestFitIndex::bestFit(int volume) const {
+    auto it = byRemaining.lower_bound({volume, INT_MIN});
+    return it == byRemaining.end() ? -1 : it->second;
+}
+
+void BestFitIndex::consume(int shelf, int volume) {
+    byRemaining.erase({rem[shelf], shelf});
+    rem[shelf] -= volume;
+    byRemaining.emplace(rem[shelf], shelf);
+}
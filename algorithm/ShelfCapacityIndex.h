@@ -0,0 +1,38 @@
+#pragma once
+#include <vector>
+#include <set>
+#include <utility>
+
+// Raf kalan kapasite indeksi (max turnuva / segment ağacı).
+// "from'dan itibaren v hacmi sığan ilk raf" sorgusu O(log m).
+class ShelfCapacityIndex {
+public:
+    void reset(int shelfCount, int capacity);
+
+    // from <= i olan ve kalan kapasitesi >= volume olan en küçük i, yoksa -1
+    int firstFit(int volume, int from = 0) const;
+
+    void consume(int shelf, int volume);
+    int remaining(int shelf) const { return tree[leaves + shelf]; }
+
+private:
+    int descend(int node, int lo, int hi, int volume, int from) const;
+
+    int shelves = 0;
+    int leaves = 0;            // 2'nin kuvveti
+    std::vector<int> tree;     // 1 tabanlı; yapraklar [leaves, 2*leaves)
+};
+
+// Best-fit indeksi: (kalan, raf) sıralı kümesi.
+// "v hacmi sığan en az boşluklu raf" sorgusu O(log m); eşitlikte küçük raf.
+class BestFitIndex {
+public:
+    void reset(int shelfCount, int capacity);
+
+    int bestFit(int volume) const;
+    void consume(int shelf, int volume);
+
+private:
+    std::vector<int> rem;
+    std::set<std::pair<int, int>> byRemaining;
+};
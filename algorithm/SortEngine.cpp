@@ -0,0 +1,114 @@
+#include "SortEngine.h"
+#include "ParallelFor.h"
+
+#include <algorithm>
+#include <array>
+#include <thread>
+
+// -------------------- helpers
+static int bitWidth(uint32_t x) {
+    int b = 0;
+    while (x) { ++b; x >>= 1; }
+    return b;
+}
+
+// -------------------- stableOrder
+std::vector<int> SortEngine::stableOrder(const std::vector<uint32_t>& keys, Method* used) {
+    const int n = (int)keys.size();
+    std::vector<int> order(n);
+    if (n == 0) {
+        if (used) *used = Method::Counting;
+        return order;
+    }
+
+    auto mm = std::minmax_element(keys.begin(), keys.end());
+    const uint32_t minKey = *mm.first;
+    const uint32_t span   = *mm.second - minKey;   // aralık - 1
+
+    if (span < kCountingMaxRange) {
+        countingPass(keys, minKey, span + 1, order);
+        if (used) *used = Method::Counting;
+        return order;
+    }
+
+    int threads = 1;
+    if (n >= kParallelMinSize) {
+        unsigned hw = std::thread::hardware_concurrency();
+        threads = (int)std::min<unsigned>(std::max(1u, hw), 16u);
+    }
+    radixSort(keys, minKey, bitWidth(span), order, threads);
+    if (used) *used = threads > 1 ? Method::ParallelRadix : Method::Radix;
+    return order;
+}
+
+// -------------------- Counting sort
+void SortEngine::countingPass(const std::vector<uint32_t>& keys, uint32_t minKey, uint32_t range,
+                              std::vector<int>& order) {
+    std::vector<int> start((size_t)range + 1, 0);
+    for (uint32_t k : keys) start[k - minKey + 1]++;
+    for (uint32_t d = 0; d < range; ++d) start[d + 1] += start[d];
+
+    for (int i = 0; i < (int)keys.size(); ++i)
+        order[start[keys[i] - minKey]++] = i;
+}
+
+// -------------------- LSD radix (8 bit basamak)
+void SortEngine::radixSort(const std::vector<uint32_t>& keys, uint32_t minKey, int bits,
+                           std::vector<int>& order, int threads) {
+    const int n = (int)keys.size();
+    const int passes = (bits + 7) / 8;
+
+    // (anahtar, indeks) çiftleri iki tampon arasında gidip gelir
+    std::vector<uint32_t> keyA(n), keyB(n);
+    std::vector<int> idxB(n);
+    for (int i = 0; i < n; ++i) {
+        keyA[i]  = keys[i] - minKey;
+        order[i] = i;
+    }
+
+    using Histogram = std::array<int, 256>;
+    std::vector<Histogram> hist(threads);
+
+    auto chunkBegin = [&](int t) { return (int)((long long)n * t / threads); };
+
+    uint32_t* srcKey = keyA.data();
+    uint32_t* dstKey = keyB.data();
+    int* srcIdx = order.data();
+    int* dstIdx = idxB.data();
+
+    for (int pass = 0; pass < passes; ++pass) {
+        const int shift = pass * 8;
+
+        parallelFor(threads, [&](int t) {
+            Histogram& h = hist[t];
+            h.fill(0);
+            for (int i = chunkBegin(t), e = chunkBegin(t + 1); i < e; ++i)
+                h[(srcKey[i] >> shift) & 0xFF]++;
+        });
+
+        // Basamak önce, iş parçacığı sonra: kararlılık korunur
+        int running = 0;
+        for (int d = 0; d < 256; ++d) {
+            for (int t = 0; t < threads; ++t) {
+                int c = hist[t][d];
+                hist[t][d] = running;
+                running += c;
+            }
+        }
+
+        parallelFor(threads, [&](int t) {
+            Histogram& pos = hist[t];
+            for (int i = chunkBegin(t), e = chunkBegin(t + 1); i < e; ++i) {
+                int p = pos[(srcKey[i] >> shift) & 0xFF]++;
+                dstKey[p] = srcKey[i];
+                dstIdx[p] = srcIdx[i];
+            }
+        });
+
+        std::swap(srcKey, dstKey);
+        std::swap(srcIdx, dstIdx);
+    }
+
+    if (srcIdx != order.data())
+        std::copy(srcIdx, srcIdx + n, order.begin());
+}
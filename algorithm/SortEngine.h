@@ -0,0 +1,38 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+
+// Tamsayı anahtarlar için kararlı sıralama motoru (permütasyon indeksi üretir).
+// - Dar anahtar aralığı  -> tek geçişli counting sort, O(n + aralık)
+// - Geniş aralık         -> LSD radix (8 bit basamak), O(n * basamak)
+// - Büyük girdiler       -> radix geçişleri iş parçacıklarına bölünür
+// Her yol kararlıdır: eşit anahtarlar girdi sırasını korur.
+class SortEngine {
+public:
+    enum class Method { Counting, Radix, ParallelRadix };
+
+    static constexpr uint32_t kCountingMaxRange = 1u << 16;
+    static constexpr int kParallelMinSize = 1 << 18;
+
+    // keys'e göre artan kararlı sıra: order[k] = k. sıradaki elemanın indeksi
+    static std::vector<int> stableOrder(const std::vector<uint32_t>& keys, Method* used = nullptr);
+
+    // Yardımcılar: int değerden artan / azalan sıralama anahtarı
+    static uint32_t ascendingKey(int x)  { return (uint32_t)x ^ 0x80000000u; }
+    static uint32_t descendingKey(int x) { return ~ascendingKey(x); }
+
+    // Permütasyonu uygula (elemanlar taşınır, kopyalanmaz)
+    template <typename T>
+    static void applyOrder(std::vector<T>& items, const std::vector<int>& order) {
+        std::vector<T> sorted;
+        sorted.reserve(items.size());
+        for (int idx : order) sorted.push_back(std::move(items[idx]));
+        items.swap(sorted);
+    }
+
+private:
+    static void countingPass(const std::vector<uint32_t>& keys, uint32_t minKey, uint32_t range,
+                             std::vector<int>& order);
+    static void radixSort(const std::vector<uint32_t>& keys, uint32_t minKey, int bits,
+                          std::vector<int>& order, int threads);
+};
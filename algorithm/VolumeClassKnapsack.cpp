@@ -0,0 +1,146 @@
+#include "VolumeClassKnapsack.h"
+
+#include <algorithm>
+#include <climits>
+#include <map>
+#include <unordered_set>
+
+// -------------------- init
+void VolumeClassKnapsack::init(const int* weights, const int* values, int n, int cap) {
+    v = values;
+    capacity = cap;
+    remaining = 0;
+    classes.clear();
+
+    // Rafa hiç sığmayan ya da satışı pozitif olmayan ürün hiçbir zaman seçilmez
+    std::map<int, int> classOf;
+    for (int i = 0; i < n; ++i) {
+        if (weights[i] < 0 || weights[i] > capacity || values[i] <= 0) continue;
+        auto it = classOf.find(weights[i]);
+        if (it == classOf.end()) {
+            it = classOf.emplace(weights[i], (int)classes.size()).first;
+            classes.push_back({});
+            classes.back().volume = weights[i];
+        }
+        classes[it->second].items.push_back(i);
+        ++remaining;
+    }
+
+    for (auto& g : classes) {
+        std::stable_sort(g.items.begin(), g.items.end(),
+                         [this](int a, int b) { return v[a] > v[b]; });
+    }
+}
+
+long long VolumeClassKnapsack::choiceTableBytes(const int* weights, const int* values, int n, int cap) {
+    if (cap < 0) return 0;
+    // init ile aynı süzgeç: yalnızca seçilebilir ürünlerin hacimleri sınıf oluşturur
+    std::unordered_set<int> volumes;
+    for (int i = 0; i < n; ++i) {
+        if (weights[i] < 0 || weights[i] > cap || values[i] <= 0) continue;
+        volumes.insert(weights[i]);
+    }
+    return (long long)volumes.size() * ((long long)cap + 1) * (long long)sizeof(int);
+}
+
+// -------------------- tek raf
+int VolumeClassKnapsack::solveNext(std::vector<int>& picked) {
+    picked.clear();
+    const int width = capacity + 1;
+    dp.assign(width, 0);
+    if (remaining == 0 || capacity < 0) return 0;
+
+    next.resize(width);
+    choice.assign(classes.size() * (size_t)width, 0);
+    cellCount = 0;
+
+    int zeroValue = 0;
+    {
+        ScopedPhase phase(profile, PlacementPhase::DPFill);
+        long long scanned = 0;
+        for (int gi = 0; gi < (int)classes.size(); ++gi) {
+            VolumeClass& g = classes[gi];
+            int avail = (int)g.items.size() - g.head;
+            if (avail == 0) continue;
+
+            // Hacmi 0 olan ürünler yer kaplamaz: hepsi alınır
+            if (g.volume == 0) {
+                for (int k = g.head; k < (int)g.items.size(); ++k) {
+                    picked.push_back(g.items[k]);
+                    zeroValue += v[g.items[k]];
+                }
+                scanned += avail;
+                remaining -= avail;
+                g.head = (int)g.items.size();
+                continue;
+            }
+
+            int cnt = std::min(avail, capacity / g.volume);
+            if (cnt == 0) continue;
+
+            prefix.resize(cnt + 1);
+            prefix[0] = 0;
+            for (int k = 1; k <= cnt; ++k)
+                prefix[k] = prefix[k - 1] + v[g.items[g.head + k - 1]];
+            scanned += cnt;
+
+            convolve(g, cnt, choice.data() + (size_t)gi * width);
+            dp.swap(next);
+        }
+
+        if (profile) {
+            profile->count(PlacementCounter::CellsEvaluated, cellCount);
+            profile->count(PlacementCounter::ItemsScanned, scanned);
+        }
+    }
+
+    const int best = dp[capacity] + zeroValue;
+
+    // Geri izleme ve tüketim aynı geçişte: sınıf başı (head) ilerletilir
+    ScopedPhase phase(profile, PlacementPhase::Traceback);
+    int c = capacity;
+    for (int gi = (int)classes.size() - 1; gi >= 0; --gi) {
+        VolumeClass& g = classes[gi];
+        int k = choice[(size_t)gi * width + c];
+        for (int t = 0; t < k; ++t)
+            picked.push_back(g.items[g.head + t]);
+        g.head += k;
+        remaining -= k;
+        c -= k * g.volume;
+    }
+    return best;
+}
+
+// -------------------- (max,+) içbükey konvolüsyon
+// next[r + j*w] = max_{i} dp[r + i*w] + prefix[j - i],  j - cnt <= i <= j
+void VolumeClassKnapsack::convolve(const VolumeClass& g, int cnt, int* choiceRow) {
+    const int w = g.volume;
+    for (int r = 0; r < w && r <= capacity; ++r) {
+        int J = (capacity - r) / w;
+        solveRange(0, J, 0, J, r, w, cnt, choiceRow);
+    }
+}
+
+void VolumeClassKnapsack::solveRange(int jl, int jr, int il, int ir,
+                                     int r, int w, int cnt, int* choiceRow) {
+    if (jl > jr) return;
+    int mid = (jl + jr) / 2;
+    int lo = std::max(il, mid - cnt);
+    int hi = std::min(ir, mid);
+
+    int best = INT_MIN;
+    int bestI = lo;
+    if (hi >= lo) cellCount += hi - lo + 1;
+    for (int i = lo; i <= hi; ++i) {
+        int val = dp[r + i * w] + prefix[mid - i];
+        if (val > best) {
+            best = val;
+            bestI = i;
+        }
+    }
+    next[r + mid * w] = best;
+    choiceRow[r + mid * w] = mid - bestI;
+
+    solveRange(jl, mid - 1, il, bestI, r, w, cnt, choiceRow);
+    solveRange(mid + 1, jr, bestI, ir, r, w, cnt, choiceRow);
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <vector>
+
+#include "PlacementProfile.h"
+
+// Hacim sınıfı sıkıştırmalı knapsack.
+// Ürünler hacme göre gruplanır, her grup satışa göre azalan sıralanır.
+// Bir sınıftan k ürün alınacaksa en iyisi her zaman ilk k'dır; bu yüzden
+// problem sınıf başına önek toplamları üzerinde sınırlı knapsack'e iner.
+// Önek toplamı içbükey olduğu için her kalan sınıfı (mod w) için en iyi
+// kaynak indeksi monotondur -> böl ve fethet ile O(C log C) / sınıf.
+class VolumeClassKnapsack {
+public:
+    // weights/values: n elemanlı bitişik diziler (nesne yaşadığı sürece geçerli)
+    void init(const int* weights, const int* values, int n, int capacity);
+
+    // Kalan ürünler üzerinde bir raf çöz; seçilenler tüketilir.
+    // picked: orijinal indeksler
+    int solveNext(std::vector<int>& picked);
+
+    int remainingCount() const { return remaining; }
+
+    // solveNext'in (sınıf, kapasite) seçim tablosunun bayt cinsinden boyutu, O(n)
+    static long long choiceTableBytes(const int* weights, const int* values, int n, int capacity);
+
+    // Son çözülen rafın son satırı (kapasite -> en iyi değer)
+    const std::vector<int>& lastRow() const { return dp; }
+
+    // Faz süreleri ve sayaçlar buraya eklenir (nullptr: ölçüm yok)
+    void setProfile(PlacementProfile* p) { profile = p; }
+
+private:
+    struct VolumeClass {
+        int volume = 0;
+        int head = 0;              // tüketilen ürün sayısı
+        std::vector<int> items;    // satışa göre azalan
+    };
+
+    void convolve(const VolumeClass& g, int cnt, int* choiceRow);
+    void solveRange(int jl, int jr, int il, int ir, int r, int w, int cnt, int* choiceRow);
+
+    PlacementProfile* profile = nullptr;
+    long long cellCount = 0;       // konvolüsyonda değerlendirilen aday sayısı
+
+    const int* v = nullptr;
+    int capacity = 0;
+    int remaining = 0;
+
+    std::vector<VolumeClass> classes;
+    std::vector<int> prefix;       // aktif sınıfın önek toplamları
+    std::vector<int> dp;
+    std::vector<int> next;
+    std::vector<int> choice;       // (sınıf, kapasite) -> alınan ürün sayısı
+};
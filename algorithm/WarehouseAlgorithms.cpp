@@ -1,32 +1,40 @@
 #include "WarehouseAlgorithms.h"
 #include "../model/Shelf.h"
+#include "../model/ShelfLayout.h"
 #include "../model/Product.h"
+#include "../model/ProductCatalog.h"
+#include "KnapsackDP.h"
+#include "VolumeClassKnapsack.h"
+#include "ShelfCapacityIndex.h"
+#include "SortEngine.h"
+
+#include "PlacementProfile.h"
+#include "WorkloadGenerator.h"
+#include "AsciiMapWriter.h"
+#include "MultiKnapsackBB.h"
+#include "ApproxKnapsack.h"
+#include "WorkStealingPool.h"
 
-#include <random>
 #include <algorithm>
-#include <chrono>
+#include <atomic>
 
 // -------------------- helpers
-static long long nowMs() {
-    return std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::high_resolution_clock::now().time_since_epoch()
-    ).count();
-}
-static long long nowUs() {
-    return std::chrono::duration_cast<std::chrono::microseconds>(
-            std::chrono::high_resolution_clock::now().time_since_epoch()
-    ).count();
+// Toplam süre tek steady_clock ölçümünden; ms / µs aynı andan türetilir
+static void finishTiming(PlacementResult& out, const Stopwatch& sw) {
+    out.profile.totalNs = sw.elapsedNs();
+    out.elapsedUs = out.profile.totalNs / 1000;
+    out.elapsedMs = out.profile.totalNs / 1000000;
 }
 
 // -------------------- DOĞRU ve TEK verimlilik hesabı
 // %100 üstü ASLA üretmez
-double WarehouseAlgorithms::computeWarehouseEfficiency(const std::vector<Shelf>& shelves) {
+double WarehouseAlgorithms::computeWarehouseEfficiency(const ShelfLayout& layout) {
     long long used = 0;
     long long capacity = 0;
 
-    for (const auto& s : shelves) {
-        used += s.used;
-        capacity += s.capacity;
+    for (int s = 0; s < layout.shelfCount(); ++s) {
+        used += layout.used[s];
+        capacity += layout.capacity[s];
     }
 
     if (capacity == 0) return 0.0;
@@ -34,233 +42,631 @@ double WarehouseAlgorithms::computeWarehouseEfficiency(const std::vector<Shelf>&
 }
 
 // -------------------- Data
-std::vector<Product> WarehouseAlgorithms::generateProducts(int count) {
-    static std::vector<QString> names = {
-            "Laptop","Telefon","Tablet","Monitor","Klavye","Mouse","Yazici","SSD",
-            "HDD","Router","Switch","Kamera","Hoparlor","Kulaklik","Powerbank",
-            "Adaptor","Kablo","Drone","Projeksiyon","Konsol"
-    };
-
-    std::mt19937 rng(std::random_device{}());
-    std::uniform_int_distribution<int> salesDist(50, 300);
-    std::uniform_int_distribution<int> volumeDist(1, 8);
-    std::uniform_int_distribution<int> nameDist(0, (int)names.size() - 1);
-
-    std::vector<Product> products;
-    products.reserve(count);
-
-    for (int i = 0; i < count; ++i) {
-        Product p;
-        p.name   = names[nameDist(rng)] + "_" + QString::number(i + 1);
-        p.sales  = salesDist(rng);
-        p.volume = volumeDist(rng);
-        products.push_back(p);
-    }
-    return products;
+ProductCatalog WarehouseAlgorithms::generateProducts(int count, const WorkloadSpec& spec) {
+    return WorkloadGenerator::generate(count, spec);
 }
 
 // -------------------- Placement: Static
-PlacementResult WarehouseAlgorithms::staticPlacement(const std::vector<Product>& products, int shelfCount, int shelfCap) {
-    long long t0ms = nowMs();
-    long long t0us = nowUs();
-
-    std::vector<Shelf> shelves(shelfCount);
-    for (auto& s : shelves) { s.capacity = shelfCap; s.used = 0; }
-
-    int idx = 0;
-    for (const auto& p : products) {
-        int tries = 0;
-        while (tries < shelfCount) {
-            int s = idx % shelfCount;
-            if (shelves[s].used + p.volume <= shelves[s].capacity) {
-                shelves[s].products.push_back(p);
-                shelves[s].used += p.volume;
-                idx++;
-                break;
-            }
-            idx++;
-            tries++;
+PlacementResult WarehouseAlgorithms::staticPlacement(const ProductCatalog& catalog, int shelfCount, int shelfCap) {
+    Stopwatch sw;
+    PlacementResult out;
+    PlacementProfile* prof = &out.profile;
+
+    ShelfLayoutBuilder layout;
+    layout.reset(shelfCount, shelfCap);
+
+    ShelfCapacityIndex index;
+    index.reset(shelfCount, shelfCap);
+
+    {
+        ScopedPhase phase(prof, PlacementPhase::ShelfFill);
+
+        // Sıradaki raftan başlayarak dairesel ilk sığan raf: O(log m)
+        const int* volume = catalog.volumeData();
+        int cursor = 0;
+        int placed = 0;
+        for (int k = 0; k < catalog.size(); ++k) {
+            int s = index.firstFit(volume[k], cursor);
+            if (s < 0) s = index.firstFit(volume[k], 0);
+            if (s < 0) continue;
+
+            layout.place(s, k, volume[k]);
+            index.consume(s, volume[k]);
+            cursor = (s + 1) % shelfCount;
+            ++placed;
         }
+        prof->count(PlacementCounter::ItemsScanned, catalog.size());
+        prof->count(PlacementCounter::ItemsPlaced, placed);
     }
 
-    long long t1ms = nowMs();
-    long long t1us = nowUs();
-
-    PlacementResult out;
-    out.shelves   = shelves;
-    out.elapsedMs = (t1ms - t0ms);
-    out.elapsedUs = (t1us - t0us);
+    {
+        ScopedPhase phase(prof, PlacementPhase::ResultCopy);
+        out.layout = layout.finish();
+    }
+    finishTiming(out, sw);
     return out;
 }
 
 // -------------------- Sorting
 void WarehouseAlgorithms::sortBySalesDesc(std::vector<Product>& products) {
-    std::sort(products.begin(), products.end(),
-              [](const Product& a, const Product& b) {
-                  return a.sales > b.sales;
-              });
+    // Satış dar aralıkta -> counting sort; geniş aralıkta radix (kararlı)
+    std::vector<uint32_t> keys(products.size());
+    for (size_t i = 0; i < products.size(); ++i)
+        keys[i] = SortEngine::descendingKey(products[i].sales);
+
+    SortEngine::applyOrder(products, SortEngine::stableOrder(keys));
 }
 void WarehouseAlgorithms::sortByNameAsc(std::vector<Product>& products) {
-    std::sort(products.begin(), products.end(),
-              [](const Product& a, const Product& b) {
-                  return a.name.toLower() < b.name.toLower();
-              });
+    // Katlanmış anahtarlar bir kez hesaplanır; karşılaştırmada bellek ayırma yok
+    NameIndex index = buildNameIndex(products);
+    SortEngine::applyOrder(products, index.order);
+}
+
+// folded: ürün başına bir kez katlanmış isimler
+static NameIndex nameIndexFromFolded(std::vector<QString> folded) {
+    const int n = (int)folded.size();
+
+    NameIndex index;
+    index.order.resize(n);
+    for (int i = 0; i < n; ++i) index.order[i] = i;
+    std::stable_sort(index.order.begin(), index.order.end(),
+                     [&](int a, int b) { return folded[a] < folded[b]; });
+
+    index.keys.reserve(n);
+    for (int idx : index.order) index.keys.push_back(std::move(folded[idx]));
+    return index;
+}
+
+NameIndex WarehouseAlgorithms::buildNameIndex(const std::vector<Product>& products) {
+    std::vector<QString> folded(products.size());
+    for (size_t i = 0; i < products.size(); ++i) folded[i] = products[i].name.toCaseFolded();
+    return nameIndexFromFolded(std::move(folded));
+}
+
+NameIndex WarehouseAlgorithms::buildNameIndex(const ProductCatalog& catalog) {
+    std::vector<QString> folded(catalog.size());
+    for (int i = 0; i < catalog.size(); ++i) folded[i] = catalog.name(i).toString().toCaseFolded();
+    return nameIndexFromFolded(std::move(folded));
 }
 
 // -------------------- Placement: Greedy
-PlacementResult WarehouseAlgorithms::greedyPlacement(std::vector<Product> products, int shelfCount, int shelfCap) {
-    long long t0ms = nowMs();
-    long long t0us = nowUs();
+PlacementResult WarehouseAlgorithms::greedyPlacement(const ProductCatalog& catalog, int shelfCount, int shelfCap) {
+    Stopwatch sw;
+    PlacementResult out;
+    PlacementProfile* prof = &out.profile;
+
+    const int* sales  = catalog.salesData();
+    const int* volume = catalog.volumeData();
+
+    // Ürünleri taşımadan, satışa göre azalan permütasyon üzerinden gez
+    std::vector<int> order;
+    {
+        ScopedPhase phase(prof, PlacementPhase::Sort);
+        std::vector<uint32_t> keys(catalog.size());
+        for (int i = 0; i < catalog.size(); ++i)
+            keys[i] = SortEngine::descendingKey(sales[i]);
+        order = SortEngine::stableOrder(keys);
+    }
 
-    sortBySalesDesc(products);
+    ShelfLayoutBuilder layout;
+    layout.reset(shelfCount, shelfCap);
 
-    std::vector<Shelf> shelves(shelfCount);
-    for (auto& s : shelves) { s.capacity = shelfCap; s.used = 0; }
+    ShelfCapacityIndex index;
+    index.reset(shelfCount, shelfCap);
 
-    for (const auto& p : products) {
-        for (int i = 0; i < shelfCount; ++i) {
-            if (shelves[i].used + p.volume <= shelves[i].capacity) {
-                shelves[i].products.push_back(p);
-                shelves[i].used += p.volume;
-                break;
-            }
+    {
+        ScopedPhase phase(prof, PlacementPhase::ShelfFill);
+        int placed = 0;
+        for (int k : order) {
+            int i = index.firstFit(volume[k]);
+            if (i < 0) continue;
+
+            layout.place(i, k, volume[k]);
+            index.consume(i, volume[k]);
+            ++placed;
         }
+        prof->count(PlacementCounter::ItemsScanned, (long long)order.size());
+        prof->count(PlacementCounter::ItemsPlaced, placed);
     }
 
-    long long t1ms = nowMs();
-    long long t1us = nowUs();
+    {
+        ScopedPhase phase(prof, PlacementPhase::ResultCopy);
+        out.layout = layout.finish();
+    }
+    finishTiming(out, sw);
+    return out;
+}
 
+// -------------------- Placement: Best-Fit Decreasing (satış / hacim)
+PlacementResult WarehouseAlgorithms::bestFitDecreasingPlacement(const ProductCatalog& catalog, int shelfCount, int shelfCap) {
+    Stopwatch sw;
     PlacementResult out;
-    out.shelves   = shelves;
-    out.elapsedMs = (t1ms - t0ms);
-    out.elapsedUs = (t1us - t0us);
+    PlacementProfile* prof = &out.profile;
+
+    const int* sales  = catalog.salesData();
+    const int* volume = catalog.volumeData();
+
+    // Satış/hacim oranına göre azalan; hacmi 0 olanlar en başa
+    std::vector<int> order(catalog.size());
+    {
+        ScopedPhase phase(prof, PlacementPhase::Sort);
+        for (int i = 0; i < (int)order.size(); ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return (long long)sales[a] * volume[b] > (long long)sales[b] * volume[a];
+        });
+    }
+
+    ShelfLayoutBuilder layout;
+    layout.reset(shelfCount, shelfCap);
+
+    BestFitIndex index;
+    index.reset(shelfCount, shelfCap);
+
+    {
+        ScopedPhase phase(prof, PlacementPhase::ShelfFill);
+        int placed = 0;
+        for (int k : order) {
+            int i = index.bestFit(volume[k]);
+            if (i < 0) continue;
+
+            layout.place(i, k, volume[k]);
+            index.consume(i, volume[k]);
+            ++placed;
+        }
+        prof->count(PlacementCounter::ItemsScanned, (long long)order.size());
+        prof->count(PlacementCounter::ItemsPlaced, placed);
+    }
+
+    {
+        ScopedPhase phase(prof, PlacementPhase::ResultCopy);
+        out.layout = layout.finish();
+    }
+    finishTiming(out, sw);
     return out;
 }
 
 // -------------------- DP Knapsack placement
-DPKnapsackResult WarehouseAlgorithms::dpPlacementKnapsack(std::vector<Product> products, int shelfCount, int shelfCap) {
-    long long t0ms = nowMs();
-    long long t0us = nowUs();
+DPKnapsackResult WarehouseAlgorithms::dpPlacementKnapsack(const ProductCatalog& catalog, int shelfCount, int shelfCap) {
+    Stopwatch sw;
+    DPKnapsackResult out;
+    PlacementProfile* prof = &out.placement.profile;
+
+    ShelfLayoutBuilder layout;
+    layout.reset(shelfCount, shelfCap);
+
+    // Sütunlar doğrudan katalogdan; ağırlık/değer kopyası yok
+    const int n = catalog.size();
+    const int* weights = catalog.volumeData();
+    const int* values  = catalog.salesData();
+    std::vector<int> pickedIdx;
+
+    // Seçilenler silinmez, canlılık maskesinden düşülür; değişmeyen DP öneki
+    // raflar arasında yeniden kullanılır.
+    IncrementalKnapsackDP engine;
+    engine.init(weights, values, n, shelfCap);
+    engine.setProfile(prof);
+
+    for (int shelfIdx = 0; shelfIdx < shelfCount; ++shelfIdx) {
+        if (engine.aliveCount() == 0) break;
+
+        engine.solveNext(pickedIdx);
+
+        {
+            ScopedPhase phase(prof, PlacementPhase::ShelfFill);
+            for (int idx : pickedIdx)
+                layout.place(shelfIdx, idx, weights[idx]);
+            prof->count(PlacementCounter::ItemsPlaced, (long long)pickedIdx.size());
+        }
+
+        if (shelfIdx == 0) {
+            ScopedPhase phase(prof, PlacementPhase::ResultCopy);
+            out.dpLastRow = engine.lastRow();
+            out.chosenForFirstShelf = pickedIdx;
+        }
+    }
+
+    {
+        ScopedPhase phase(prof, PlacementPhase::ResultCopy);
+        out.placement.layout = layout.finish();
+    }
+    finishTiming(out.placement, sw);
+    return out;
+}
+
+// -------------------- DP Knapsack placement (hacim sınıfları)
+DPKnapsackResult WarehouseAlgorithms::dpPlacementVolumeClasses(const ProductCatalog& catalog, int shelfCount, int shelfCap) {
+    Stopwatch sw;
+    DPKnapsackResult out;
+    PlacementProfile* prof = &out.placement.profile;
+
+    ShelfLayoutBuilder layout;
+    layout.reset(shelfCount, shelfCap);
 
-    std::vector<Shelf> shelves(shelfCount);
-    for (auto& s : shelves) { s.capacity = shelfCap; s.used = 0; }
+    // Sütunlar doğrudan katalogdan; ağırlık/değer kopyası yok
+    const int n = catalog.size();
+    const int* weights = catalog.volumeData();
+    const int* values  = catalog.salesData();
+    std::vector<int> pickedIdx;
 
-    std::vector<std::vector<int>> firstDp;
-    std::vector<Product> firstChosen;
+    VolumeClassKnapsack engine;
+    engine.init(weights, values, n, shelfCap);
+    engine.setProfile(prof);
 
     for (int shelfIdx = 0; shelfIdx < shelfCount; ++shelfIdx) {
-        int n = (int)products.size();
-        if (n == 0) break;
-
-        std::vector<std::vector<int>> dp(n + 1, std::vector<int>(shelfCap + 1, 0));
-
-        for (int i = 1; i <= n; ++i) {
-            int w = products[i - 1].volume;
-            int v = products[i - 1].sales;
-            for (int cap = 0; cap <= shelfCap; ++cap) {
-                dp[i][cap] = dp[i - 1][cap];
-                if (w <= cap) {
-                    dp[i][cap] = std::max(dp[i][cap],
-                                           dp[i - 1][cap - w] + v);
+        if (engine.remainingCount() == 0) break;
+
+        engine.solveNext(pickedIdx);
+
+        {
+            ScopedPhase phase(prof, PlacementPhase::ShelfFill);
+            for (int idx : pickedIdx)
+                layout.place(shelfIdx, idx, weights[idx]);
+            prof->count(PlacementCounter::ItemsPlaced, (long long)pickedIdx.size());
+        }
+
+        if (shelfIdx == 0) {
+            ScopedPhase phase(prof, PlacementPhase::ResultCopy);
+            out.dpLastRow = engine.lastRow();
+            out.chosenForFirstShelf = pickedIdx;
+        }
+    }
+
+    {
+        ScopedPhase phase(prof, PlacementPhase::ResultCopy);
+        out.placement.layout = layout.finish();
+    }
+    finishTiming(out.placement, sw);
+    return out;
+}
+
+// -------------------- DP Knapsack placement (ayrıştırılmış, paralel)
+// Aday havuzu toplam kapasitenin bu katı kadar hacim içerir (LP sınırının biraz ötesi)
+static constexpr double kPoolOvershoot = 1.5;
+// Onarımda bir rafın yeniden çözümüne katılan seçilmemiş aday hacmi (C katı)
+static constexpr double kRepairOvershoot = 4.0;
+
+PlacementResult WarehouseAlgorithms::dpPlacementParallel(const ProductCatalog& catalog, int shelfCount, int shelfCap, int threads) {
+    Stopwatch sw;
+    PlacementResult out;
+    PlacementProfile* prof = &out.profile;
+
+    const int n = catalog.size();
+    const int* weights = catalog.volumeData();
+    const int* values  = catalog.salesData();
+    const int m = std::max(0, shelfCount);
+
+    ShelfLayoutBuilder layout;
+    layout.reset(m, shelfCap);
+    if (m == 0 || shelfCap < 0) {
+        out.layout = layout.finish();
+        finishTiming(out, sw);
+        return out;
+    }
+
+    // Satış/hacim oranına göre azalan adaylar; hacmi 0 olanlar doğrudan ilk rafa
+    auto byRatio = [&](int a, int b) {
+        return (long long)values[a] * weights[b] > (long long)values[b] * weights[a];
+    };
+    std::vector<int> order;
+    int placed = 0;
+    {
+        ScopedPhase phase(prof, PlacementPhase::Sort);
+        order.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            if (values[i] <= 0 || weights[i] < 0 || weights[i] > shelfCap) continue;
+            if (weights[i] == 0) { layout.place(0, i, 0); ++placed; continue; }
+            order.push_back(i);
+        }
+        std::stable_sort(order.begin(), order.end(), byRatio);
+    }
+
+    // LP sıralı önek, raflara yılan (0..m-1, m-1..0) sırasıyla dağıtılır:
+    // her havuz benzer oran profiline ve ~kPoolOvershoot * C hacme sahip olur
+    std::vector<std::vector<int>> pools(m);
+    size_t poolEnd = 0;
+    {
+        ScopedPhase phase(prof, PlacementPhase::ShelfFill);
+        const double target = kPoolOvershoot * (double)m * shelfCap;
+        double volume = 0;
+        for (; poolEnd < order.size() && volume < target; ++poolEnd) {
+            const size_t round = poolEnd / m, pos = poolEnd % m;
+            const int s = (int)((round & 1) ? m - 1 - pos : pos);
+            pools[s].push_back(order[poolEnd]);
+            volume += weights[order[poolEnd]];
+        }
+    }
+
+    // Raf DP'leri birbirinden bağımsız: her görev kendi havuzunu çözer
+    std::vector<std::vector<int>> picked(m);
+    std::atomic<long long> cells{0};
+    {
+        ScopedPhase phase(prof, PlacementPhase::DPFill);
+        const int hw = threads > 0 ? threads : (int)std::max(1u, std::thread::hardware_concurrency());
+        WorkStealingPool pool(std::min(hw, m));
+        for (int s = 0; s < m; ++s) {
+            pool.submit([&, s] {
+                const std::vector<int>& items = pools[s];
+                const int k = (int)items.size();
+                std::vector<int> w(k), v(k), local;
+                for (int j = 0; j < k; ++j) {
+                    w[j] = weights[items[j]];
+                    v[j] = values[items[j]];
                 }
+                KnapsackDP dp;
+                dp.solve(w.data(), v.data(), k, shelfCap, local);
+                for (int j : local) picked[s].push_back(items[j]);
+                cells.fetch_add((long long)k * (shelfCap + 1), std::memory_order_relaxed);
+            });
+        }
+        pool.wait();
+    }
+    prof->count(PlacementCounter::CellsEvaluated, cells.load());
+
+    // Onarım: boşluğu kalan raflar (en boştan başlayarak) kendi seçtikleri ve
+    // seçilmemiş adayların oran sıralı bir öneki üzerinde yeniden çözülür; raf
+    // değeri düşmez, dışarıda kalan kendi ürünleri sonraki raflara aday olur.
+    // Seçilmemişler bir kez toplanır ve baştaki pencere her rafta sıkıştırılır:
+    // alınanlar bir daha taranmaz, toplam tarama O(n + m * pencere)
+    {
+        ScopedPhase phase(prof, PlacementPhase::Compaction);
+        std::vector<uint8_t> taken(n, 0);
+        std::vector<int> residual(m, shelfCap);
+        for (int s = 0; s < m; ++s) {
+            for (int i : picked[s]) {
+                residual[s] -= weights[i];
+                taken[i] = 1;
             }
         }
 
-        int cap = shelfCap;
-        std::vector<int> pickedIdx;
-        for (int i = n; i >= 1; --i) {
-            if (dp[i][cap] != dp[i - 1][cap]) {
-                pickedIdx.push_back(i - 1);
-                cap -= products[i - 1].volume;
+        std::vector<int> shelfOrder(m);
+        for (int s = 0; s < m; ++s) shelfOrder[s] = s;
+        std::stable_sort(shelfOrder.begin(), shelfOrder.end(),
+                         [&](int a, int b) { return residual[a] > residual[b]; });
+
+        std::vector<int> leftover;
+        for (int i : order)
+            if (!taken[i]) leftover.push_back(i);
+        size_t head = 0;
+
+        KnapsackDP dp;
+        std::vector<int> items, w, v, local, dropped;
+        const double repairVolume = kRepairOvershoot * shelfCap;
+        for (int s : shelfOrder) {
+            if (residual[s] == 0) continue;
+
+            items = picked[s];
+            double volume = 0;
+            size_t end = head;
+            for (; end < leftover.size() && volume < repairVolume; ++end) {
+                const int i = leftover[end];
+                items.push_back(i);
+                volume += weights[i];
+            }
+            if (items.size() == picked[s].size()) continue;
+
+            w.resize(items.size());
+            v.resize(items.size());
+            for (size_t j = 0; j < items.size(); ++j) {
+                w[j] = weights[items[j]];
+                v[j] = values[items[j]];
+            }
+            dp.solve(w.data(), v.data(), (int)items.size(), shelfCap, local);
+            prof->count(PlacementCounter::CellsEvaluated, (long long)items.size() * (shelfCap + 1));
+
+            for (int i : picked[s]) taken[i] = 0;
+            dropped.swap(picked[s]);
+            picked[s].clear();
+            for (int j : local) {
+                picked[s].push_back(items[j]);
+                taken[items[j]] = 1;
             }
-        }
 
-        int used = 0;
-        for (int idx : pickedIdx) {
-            shelves[shelfIdx].products.push_back(products[idx]);
-            used += products[idx].volume;
+            // Pencerede alınanlar atılır, kalanlar sırasını koruyarak pencere sonuna kayar
+            size_t write = end;
+            for (size_t k = end; k-- > head;)
+                if (!taken[leftover[k]]) leftover[--write] = leftover[k];
+            head = write;
+
+            // Rafın bıraktığı ürünler oran sırasıyla pencerenin önüne döner
+            dropped.erase(std::remove_if(dropped.begin(), dropped.end(),
+                                         [&](int i) { return taken[i] != 0; }), dropped.end());
+            if (dropped.empty()) continue;
+            std::stable_sort(dropped.begin(), dropped.end(), byRatio);
+            if (head < dropped.size()) {
+                leftover.insert(leftover.begin() + head, dropped.size() - head, 0);
+                head = dropped.size();
+            }
+            head -= dropped.size();
+            std::copy(dropped.begin(), dropped.end(), leftover.begin() + head);
         }
-        shelves[shelfIdx].used = used;
 
-        if (shelfIdx == 0) {
-            firstDp = dp;
-            for (int idx : pickedIdx)
-                firstChosen.push_back(products[idx]);
+        for (int s = 0; s < m; ++s) {
+            for (int i : picked[s]) layout.place(s, i, weights[i]);
+            placed += (int)picked[s].size();
         }
+    }
+    prof->count(PlacementCounter::ItemsScanned, (long long)order.size());
+    prof->count(PlacementCounter::ItemsPlaced, placed);
+
+    {
+        ScopedPhase phase(prof, PlacementPhase::ResultCopy);
+        out.layout = layout.finish();
+    }
+    finishTiming(out, sw);
+    return out;
+}
+
+// -------------------- Approx placement (GCD / FPTAS)
+ApproxPlacementResult WarehouseAlgorithms::approxPlacementKnapsack(const ProductCatalog& catalog, int shelfCount, int shelfCap,
+                                                                   const ApproxKnapsackOptions& options) {
+    Stopwatch sw;
+    ApproxPlacementResult out;
+    PlacementProfile* prof = &out.placement.profile;
+
+    ShelfLayoutBuilder layout;
+    layout.reset(shelfCount, shelfCap);
 
-        std::sort(pickedIdx.begin(), pickedIdx.end());
-        for (int i = (int)pickedIdx.size() - 1; i >= 0; --i) {
-            products.erase(products.begin() + pickedIdx[i]);
+    const int n = catalog.size();
+    const int* weights = catalog.volumeData();
+    const int* values  = catalog.salesData();
+    std::vector<int> pickedIdx;
+
+    ApproxKnapsack engine;
+    engine.init(weights, values, n, shelfCap, options);
+    engine.setProfile(prof);
+
+    for (int shelfIdx = 0; shelfIdx < shelfCount; ++shelfIdx) {
+        if (engine.remainingCount() == 0) break;
+
+        engine.solveNext(pickedIdx);
+
+        ScopedPhase phase(prof, PlacementPhase::ShelfFill);
+        for (int idx : pickedIdx)
+            layout.place(shelfIdx, idx, weights[idx]);
+        prof->count(PlacementCounter::ItemsPlaced, (long long)pickedIdx.size());
+    }
+
+    {
+        ScopedPhase phase(prof, PlacementPhase::ResultCopy);
+        out.placement.layout = layout.finish();
+    }
+
+    out.epsilon          = options.epsilon;
+    out.effectiveEpsilon = engine.effectiveEpsilon();
+    out.guaranteedRatio  = engine.guaranteedRatio();
+    out.exactShelves     = engine.exactShelves();
+    out.scaledShelves    = engine.scaledShelves();
+    out.peakTableBytes   = engine.peakTableBytes();
+
+    finishTiming(out.placement, sw);
+    return out;
+}
+
+// -------------------- Local search (yerleşim sonrası iyileştirme)
+PlacementResult WarehouseAlgorithms::improvePlacement(const PlacementResult& start, const ProductCatalog& catalog,
+                                                      const LocalSearchOptions& options, LocalSearchStats* stats) {
+    Stopwatch sw;
+    PlacementResult out;
+    out.layout = LocalSearch::improve(start.layout, catalog, options, stats, &out.profile);
+    finishTiming(out, sw);
+    return out;
+}
+
+// -------------------- Exact placement (dal-sınır)
+ExactPlacementResult WarehouseAlgorithms::exactPlacementBranchAndBound(const ProductCatalog& catalog, int shelfCount, int shelfCap,
+                                                                       const BranchAndBoundOptions& options) {
+    Stopwatch sw;
+    ExactPlacementResult out;
+    PlacementProfile* prof = &out.placement.profile;
+
+    const int n = catalog.size();
+    const int* weights = catalog.volumeData();
+    const int* values  = catalog.salesData();
+
+    // Rafları tek tek dolduran DP iyi bir alt sınırdır; budamayı baştan sıkılaştırır.
+    // dpPlacementVolumeClasses ile aynı döngü, raflar arasında iptal denetlenir
+    std::vector<int> initial(n, -1);
+    {
+        ScopedPhase phase(prof, PlacementPhase::DPFill);
+        VolumeClassKnapsack seed;
+        seed.init(weights, values, n, shelfCap);
+        std::vector<int> picked;
+        for (int s = 0; s < shelfCount && seed.remainingCount() > 0; ++s) {
+            if (options.cancel && options.cancel->load(std::memory_order_relaxed)) break;
+            seed.solveNext(picked);
+            for (int i : picked) initial[i] = s;
         }
     }
 
-    long long t1ms = nowMs();
-    long long t1us = nowUs();
+    MultiKnapsackBB::Result bb;
+    {
+        ScopedPhase phase(prof, PlacementPhase::ShelfFill);
+        bb = MultiKnapsackBB::solve(weights, values, n, shelfCount, shelfCap, initial, options);
+    }
+    prof->count(PlacementCounter::NodesExplored, bb.nodes);
+    prof->count(PlacementCounter::ItemsScanned, n);
+
+    {
+        ScopedPhase phase(prof, PlacementPhase::ResultCopy);
+        ShelfLayoutBuilder layout;
+        layout.reset(shelfCount, shelfCap);
+        long long placed = 0;
+        for (int i = 0; i < n; ++i) {
+            if (bb.shelfOf[i] < 0) continue;
+            layout.place(bb.shelfOf[i], i, weights[i]);
+            ++placed;
+        }
+        prof->count(PlacementCounter::ItemsPlaced, placed);
+        out.placement.layout = layout.finish();
+    }
 
-    DPKnapsackResult out;
-    out.placement.shelves   = shelves;
-    out.placement.elapsedMs = (t1ms - t0ms);
-    out.placement.elapsedUs = (t1us - t0us);
+    out.placedSales = bb.value;
+    out.upperBound = bb.upperBound;
+    out.nodes = bb.nodes;
+    out.provenOptimal = bb.provenOptimal;
+    out.threads = bb.threads;
 
-    out.dpTable = firstDp;
-    out.chosenForFirstShelf = firstChosen;
+    finishTiming(out.placement, sw);
     return out;
 }
 
 // -------------------- Searching
-SearchResult WarehouseAlgorithms::linearSearchByName(const std::vector<Product>& products, const QString& name) {
-    long long t0 = nowUs();
-    for (int i = 0; i < (int)products.size(); ++i) {
-        if (products[i].name.compare(name, Qt::CaseInsensitive) == 0) {
-            long long t1 = nowUs();
-            return { true, i, (t1 - t0) };
+SearchResult WarehouseAlgorithms::linearSearchByName(const ProductCatalog& catalog, const QString& name) {
+    Stopwatch sw;
+    for (int i = 0; i < catalog.size(); ++i) {
+        if (catalog.name(i).compare(name, Qt::CaseInsensitive) == 0) {
+            return { true, i, sw.elapsedUs() };
         }
     }
-    long long t1 = nowUs();
-    return { false, -1, (t1 - t0) };
+    return { false, -1, sw.elapsedUs() };
 }
 
 SearchResult WarehouseAlgorithms::binarySearchByName(const std::vector<Product>& productsSortedByName, const QString& name) {
-    long long t0 = nowUs();
+    Stopwatch sw;
 
     int l = 0, r = (int)productsSortedByName.size() - 1;
-    QString key = name.toLower();
+    const QString key = name.toCaseFolded();
 
     while (l <= r) {
         int mid = (l + r) / 2;
-        QString cur = productsSortedByName[mid].name.toLower();
-        if (cur == key) {
-            long long t1 = nowUs();
-            return { true, mid, (t1 - t0) };
+        int cmp = QString::compare(productsSortedByName[mid].name, key, Qt::CaseInsensitive);
+        if (cmp == 0) {
+            return { true, mid, sw.elapsedUs() };
         }
-        if (cur < key) l = mid + 1;
+        if (cmp < 0) l = mid + 1;
         else r = mid - 1;
     }
 
-    long long t1 = nowUs();
-    return { false, -1, (t1 - t0) };
+    return { false, -1, sw.elapsedUs() };
+}
+
+SearchResult WarehouseAlgorithms::binarySearchByName(const NameIndex& index, const QString& name) {
+    Stopwatch sw;
+
+    const QString key = name.toCaseFolded();
+    auto it = std::lower_bound(index.keys.begin(), index.keys.end(), key);
+    if (it != index.keys.end() && *it == key) {
+        return { true, index.order[it - index.keys.begin()], sw.elapsedUs() };
+    }
+
+    return { false, -1, sw.elapsedUs() };
+}
+
+SearchResult WarehouseAlgorithms::hashSearchByName(const ProductLocationIndex& index, const QString& name) {
+    Stopwatch sw;
+    ProductLocation loc = index.find(name);
+
+    if (loc.catalogIndex < 0) return { false, -1, sw.elapsedUs() };
+    return { true, loc.catalogIndex, sw.elapsedUs() };
 }
 
 // -------------------- ASCII Map
-QString WarehouseAlgorithms::buildAsciiMap(const std::vector<Shelf>& shelves) {
+QString WarehouseAlgorithms::buildAsciiMap(const ShelfLayout& layout, const ProductCatalog& catalog) {
+    AsciiMapWriter writer(layout, catalog);
+
     QString out;
-    out += "=========== ASCII DEPO HARITASI ===========\n";
-    for (int i = 0; i < (int)shelves.size(); ++i) {
-        const auto& s = shelves[i];
-        out += QString("Raf %1 | Kapasite:%2 | Kullanilan:%3 | Bos:%4\n")
-                .arg(i + 1).arg(s.capacity).arg(s.used).arg(s.capacity - s.used);
-
-        int barLen = 30;
-        int filled = (s.capacity == 0) ? 0 : (int)((double)s.used / s.capacity * barLen);
-        out += "[";
-        for (int k = 0; k < barLen; ++k) out += (k < filled ? "#" : ".");
-        out += "]\n";
-
-        for (const auto& p : s.products) {
-            out += QString("  - %1 (Satis:%2, Hacim:%3)\n")
-                    .arg(p.name).arg(p.sales).arg(p.volume);
-        }
-        out += "\n";
-    }
+    out.reserve(writer.sizeHint(0, layout.shelfCount()));
+    StringMapSink sink(out);
+    writer.writeAll(sink);
     return out;
 }
@@ -4,19 +4,56 @@
 
 #include "../model/Product.h"
 #include "../model/Shelf.h"
+#include "../model/ShelfLayout.h"
+#include "../model/ProductCatalog.h"
+#include "ProductLocationIndex.h"
+#include "PlacementProfile.h"
+#include "WorkloadGenerator.h"
+#include "MultiKnapsackBB.h"
+#include "ApproxKnapsack.h"
+#include "LocalSearch.h"
 
 struct PlacementResult {
-    std::vector<Shelf> shelves;
+    ShelfLayout layout;           // raf başına katalog indeks aralıkları
     double efficiency = 0.0;
 
+    // Toplam süre (profile.totalNs'ten türetilir)
     long long elapsedMs = 0;
     long long elapsedUs = 0;
+
+    PlacementProfile profile;     // faz süreleri ve sayaçlar
 };
 
 struct DPKnapsackResult {
     PlacementResult placement;
-    std::vector<std::vector<int>> dpTable;      // 1. raf DP tablosu
-    std::vector<Product> chosenForFirstShelf;   // 1. raf seçilenler
+    std::vector<int> dpLastRow;                 // 1. raf DP son satırı (kapasite -> en iyi değer)
+    std::vector<int> chosenForFirstShelf;       // 1. raf seçilenler (katalog indeksleri)
+};
+
+struct ExactPlacementResult {
+    PlacementResult placement;
+    long long placedSales = 0;     // yerleşen ürünlerin toplam satışı
+    long long upperBound = 0;      // provenOptimal ise placedSales'e eşit
+    long long nodes = 0;
+    bool provenOptimal = false;    // false: limit aşıldı, en iyi bulunan döndü
+    int threads = 1;
+};
+
+struct ApproxPlacementResult {
+    PlacementResult placement;
+    double epsilon = 0.0;             // istenen
+    double effectiveEpsilon = 0.0;    // bellek bütçesi nedeniyle büyümüş olabilir
+    double guaranteedRatio = 1.0;     // her raf >= oran * (aynı kalan ürünlerle kesin DP)
+    int exactShelves = 0;             // GCD indirgemesiyle kesin çözülen raflar
+    int scaledShelves = 0;            // FPTAS ile çözülen raflar
+    long long peakTableBytes = 0;
+};
+
+// İsme göre sıralı görünüm: isimler bir kez katlanır (case-fold),
+// sıralama ve ikili arama aynı anahtarları kullanır.
+struct NameIndex {
+    std::vector<QString> keys;   // artan sıralı, katlanmış isimler
+    std::vector<int> order;      // keys[k] -> orijinal ürün indeksi
 };
 
 struct SearchResult {
@@ -27,24 +64,46 @@ struct SearchResult {
 
 class WarehouseAlgorithms {
 public:
-    static double computeWarehouseEfficiency(const std::vector<Shelf>& shelves);
+    static double computeWarehouseEfficiency(const ShelfLayout& layout);
 
-    // Veri
-    static std::vector<Product> generateProducts(int count);
+    // Veri: aynı seed ve ayarlarla her zaman aynı katalog
+    static ProductCatalog generateProducts(int count, const WorkloadSpec& spec = WorkloadSpec());
 
     // Yerleşim
-    static PlacementResult staticPlacement(const std::vector<Product>& products, int shelfCount, int shelfCap);
-    static PlacementResult greedyPlacement(std::vector<Product> products, int shelfCount, int shelfCap);
-    static DPKnapsackResult dpPlacementKnapsack(std::vector<Product> products, int shelfCount, int shelfCap);
+    static PlacementResult staticPlacement(const ProductCatalog& catalog, int shelfCount, int shelfCap);
+    static PlacementResult greedyPlacement(const ProductCatalog& catalog, int shelfCount, int shelfCap);
+    static PlacementResult bestFitDecreasingPlacement(const ProductCatalog& catalog, int shelfCount, int shelfCap);
+    static DPKnapsackResult dpPlacementKnapsack(const ProductCatalog& catalog, int shelfCount, int shelfCap);
+    // Aynı raf değerini hacim sınıfları üzerinden O(sınıf * C log C) ile bulur
+    static DPKnapsackResult dpPlacementVolumeClasses(const ProductCatalog& catalog, int shelfCount, int shelfCap);
+    // Raflar bağımsız aday havuzlarına bölünür ve eşzamanlı DP ile çözülür;
+    // kalanlar best-fit onarımıyla yerleştirilir. threads <= 0: donanım sayısı
+    static PlacementResult dpPlacementParallel(const ProductCatalog& catalog, int shelfCount, int shelfCap, int threads = 0);
+    // Büyük kapasiteler için: GCD indirgemeli kesin DP ya da ε-FPTAS, bellek sınırlı
+    static ApproxPlacementResult approxPlacementKnapsack(const ProductCatalog& catalog, int shelfCount, int shelfCap,
+                                                         const ApproxKnapsackOptions& options = ApproxKnapsackOptions());
+    // Herhangi bir yerleşimi süre bütçesi içinde yerel aramayla iyileştirir (anytime)
+    static PlacementResult improvePlacement(const PlacementResult& start, const ProductCatalog& catalog,
+                                            const LocalSearchOptions& options = LocalSearchOptions(),
+                                            LocalSearchStats* stats = nullptr);
+    // Tüm raflar birlikte, dal-sınır ile kesin (limit içinde); başlangıç alt sınırı DP
+    static ExactPlacementResult exactPlacementBranchAndBound(const ProductCatalog& catalog, int shelfCount, int shelfCap,
+                                                             const BranchAndBoundOptions& options = BranchAndBoundOptions());
 
     // Sorting
     static void sortBySalesDesc(std::vector<Product>& products);
     static void sortByNameAsc(std::vector<Product>& products);
+    static NameIndex buildNameIndex(const std::vector<Product>& products);
+    static NameIndex buildNameIndex(const ProductCatalog& catalog);
 
     // Searching
-    static SearchResult linearSearchByName(const std::vector<Product>& products, const QString& name);
+    static SearchResult linearSearchByName(const ProductCatalog& catalog, const QString& name);
     static SearchResult binarySearchByName(const std::vector<Product>& productsSortedByName, const QString& name);
+    // index: bulunan ürünün orijinal indeksi
+    static SearchResult binarySearchByName(const NameIndex& index, const QString& name);
+    // index: bulunan ürünün katalog indeksi, O(1)
+    static SearchResult hashSearchByName(const ProductLocationIndex& index, const QString& name);
 
-    // ASCII depo haritası
-    static QString buildAsciiMap(const std::vector<Shelf>& shelves);
+    // ASCII depo haritası (tamamı bellekte; büyük haritalar için AsciiMapWriter)
+    static QString buildAsciiMap(const ShelfLayout& layout, const ProductCatalog& catalog);
 };
@@ -0,0 +1,106 @@
+#include "WorkStealingPool.h"
+
+#include <algorithm>
+
+namespace {
+thread_local const WorkStealingPool* tlsPool = nullptr;
+thread_local int tlsWorker = -1;
+}
+
+WorkStealingPool::WorkStealingPool(int threads) {
+    if (threads <= 0) threads = (int)std::max(1u, std::thread::hardware_concurrency());
+
+    queues.reserve(threads);
+    for (int t = 0; t < threads; ++t) queues.push_back(std::make_unique<Queue>());
+
+    workers.reserve(threads);
+    for (int t = 0; t < threads; ++t) workers.emplace_back(&WorkStealingPool::workerLoop, this, t);
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    wait();
+    {
+        std::lock_guard<std::mutex> g(sleepLock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& w : workers) w.join();
+}
+
+int WorkStealingPool::currentWorker() const {
+    return (tlsPool == this) ? tlsWorker : -1;
+}
+
+void WorkStealingPool::submit(Task task) {
+    int q = currentWorker();
+    if (q < 0) q = nextQueue.fetch_add(1, std::memory_order_relaxed) % threadCount();
+
+    pending.fetch_add(1, std::memory_order_acq_rel);
+    {
+        std::lock_guard<std::mutex> g(queues[q]->lock);
+        queues[q]->tasks.push_back(std::move(task));
+    }
+    // Sıra sayacı sleepLock altında artar: uyumak üzere olan işçi ya artışı
+    // bekleme koşulunda görür ya da zaten bekliyordur ve bildirimi alır
+    {
+        std::lock_guard<std::mutex> g(sleepLock);
+        submitSeq.fetch_add(1, std::memory_order_release);
+        if (idle.load(std::memory_order_relaxed) > 0) wake.notify_one();
+    }
+}
+
+void WorkStealingPool::wait() {
+    std::unique_lock<std::mutex> g(sleepLock);
+    drained.wait(g, [this] { return pending.load(std::memory_order_acquire) == 0; });
+}
+
+bool WorkStealingPool::tryPop(int self, Task& out) {
+    // Önce kendi kuyruğunun sonu
+    {
+        Queue& q = *queues[self];
+        std::lock_guard<std::mutex> g(q.lock);
+        if (!q.tasks.empty()) {
+            out = std::move(q.tasks.back());
+            q.tasks.pop_back();
+            return true;
+        }
+    }
+    // Sonra diğerlerinin başı
+    const int n = threadCount();
+    for (int k = 1; k < n; ++k) {
+        Queue& q = *queues[(self + k) % n];
+        std::lock_guard<std::mutex> g(q.lock);
+        if (!q.tasks.empty()) {
+            out = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(int self) {
+    tlsPool = this;
+    tlsWorker = self;
+
+    Task task;
+    for (;;) {
+        // Kuyruklara bakmadan önce görülen sıra; sonrasındaki her submit onu değiştirir
+        const uint64_t seen = submitSeq.load(std::memory_order_acquire);
+        if (tryPop(self, task)) {
+            task();
+            task = nullptr;
+            if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> g(sleepLock);
+                drained.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> g(sleepLock);
+        idle.fetch_add(1, std::memory_order_relaxed);
+        wake.wait(g, [&] { return stopping || submitSeq.load(std::memory_order_relaxed) != seen; });
+        idle.fetch_sub(1, std::memory_order_relaxed);
+        if (stopping) return;
+    }
+}
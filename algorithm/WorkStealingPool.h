@@ -0,0 +1,64 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// İş çalan (work-stealing) görev havuzu.
+// Her işçinin kendi kuyruğu vardır: kendi görevlerini sondan (LIFO, önbellek
+// dostu derinlik öncelikli), başkalarınınkini baştan (FIFO, büyük alt ağaçlar)
+// alır. Görevler yeni görev üretebilir; wait() hepsi bitene kadar bekler.
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    // threads <= 0: donanım iş parçacığı sayısı
+    explicit WorkStealingPool(int threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    int threadCount() const { return (int)workers.size(); }
+
+    // İşçi içinden çağrılırsa o işçinin kuyruğuna, dışarıdan sırayla dağıtılır
+    void submit(Task task);
+
+    // Gönderilen ve onlardan türeyen tüm görevler bitene kadar bekle
+    void wait();
+
+    // Boşta bekleyen işçi sayısı (görev bölme kararları için ipucu)
+    int idleCount() const { return idle.load(std::memory_order_relaxed); }
+    // Kuyrukta ya da çalışmakta olan görev sayısı
+    long long pendingCount() const { return pending.load(std::memory_order_relaxed); }
+
+    // Çağıran iş parçacığı bu havuzun işçisiyse indeksi, değilse -1
+    int currentWorker() const;
+
+private:
+    struct Queue {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    void workerLoop(int self);
+    bool tryPop(int self, Task& out);
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex sleepLock;
+    std::condition_variable wake;       // yeni görev ya da kapanış
+    std::condition_variable drained;    // pending == 0
+
+    std::atomic<long long> pending{0};  // gönderilmiş, bitmemiş görev
+    std::atomic<int> idle{0};           // sleepLock altında değişir
+    std::atomic<uint64_t> submitSeq{0};  // sleepLock altında artar
+    std::atomic<int> nextQueue{0};
+    bool stopping = false;
+};
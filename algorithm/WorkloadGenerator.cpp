@@ -0,0 +1,180 @@
+#include "WorkloadGenerator.h"
+#include "ParallelFor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// -------------------- helpers
+static inline uint64_t splitmix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Ürün başına bağımsız akışlar
+enum Stream : uint64_t { SalesStream = 0, VolumeStream = 1, NameStream = 2, NoiseStream = 3 };
+
+// SplitMix64 dizisinin (index * 4 + stream). elemanı: doğrudan erişim, durum yok
+static inline uint64_t draw(uint64_t key, uint64_t index, Stream stream) {
+    return splitmix64(key + (index * 4 + stream) * 0x9E3779B97F4A7C15ULL);
+}
+
+// [0, 1)
+static inline double unit(uint64_t r) {
+    return (double)(r >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// [lo, hi]
+static inline int uniformInt(uint64_t r, int lo, int hi) {
+    const double span = (double)hi - (double)lo + 1.0;
+    return lo + std::min((int)(unit(r) * span), hi - lo);
+}
+
+static int decimalDigits(uint32_t x) {
+    int d = 1;
+    while (x >= 10) { x /= 10; ++d; }
+    return d;
+}
+
+static const char* const kBaseNames[] = {
+    "Laptop","Telefon","Tablet","Monitor","Klavye","Mouse","Yazici","SSD",
+    "HDD","Router","Switch","Kamera","Hoparlor","Kulaklik","Powerbank",
+    "Adaptor","Kablo","Drone","Projeksiyon","Konsol"
+};
+static constexpr int kBaseNameCount = (int)(sizeof(kBaseNames) / sizeof(kBaseNames[0]));
+
+// -------------------- names
+const char* WorkloadGenerator::distributionName(WorkloadSpec::Distribution d) {
+    switch (d) {
+        case WorkloadSpec::Distribution::Uniform:           return "uniform";
+        case WorkloadSpec::Distribution::ZipfSales:         return "zipf";
+        case WorkloadSpec::Distribution::Correlated:        return "correlated";
+        case WorkloadSpec::Distribution::ManyVolumeClasses: return "classes";
+    }
+    return "?";
+}
+
+bool WorkloadGenerator::parseDistribution(const char* name, WorkloadSpec::Distribution& out) {
+    for (auto d : { WorkloadSpec::Distribution::Uniform, WorkloadSpec::Distribution::ZipfSales,
+                    WorkloadSpec::Distribution::Correlated, WorkloadSpec::Distribution::ManyVolumeClasses }) {
+        if (std::strcmp(name, distributionName(d)) == 0) {
+            out = d;
+            return true;
+        }
+    }
+    return false;
+}
+
+// -------------------- generate
+ProductCatalog WorkloadGenerator::generate(int count, const WorkloadSpec& spec) {
+    const int n = std::max(0, count);
+    const uint64_t key = splitmix64(spec.seed);
+
+    const int salesLo = std::min(spec.salesMin, spec.salesMax);
+    const int salesHi = std::max(spec.salesMin, spec.salesMax);
+    int volumeLo = std::min(spec.volumeMin, spec.volumeMax);
+    int volumeHi = std::max(spec.volumeMin, spec.volumeMax);
+    if (spec.distribution == WorkloadSpec::Distribution::ManyVolumeClasses)
+        volumeHi = volumeLo + std::max(1, spec.volumeClasses) - 1;
+
+    // Zipf: sıra k (1..R) olasılığı 1/k^s; satış = salesLo + k - 1
+    std::vector<double> zipfCdf;
+    if (spec.distribution == WorkloadSpec::Distribution::ZipfSales) {
+        const int ranks = salesHi - salesLo + 1;
+        zipfCdf.resize(ranks);
+        double sum = 0.0;
+        for (int k = 0; k < ranks; ++k) {
+            sum += 1.0 / std::pow((double)(k + 1), spec.zipfExponent);
+            zipfCdf[k] = sum;
+        }
+        for (double& c : zipfCdf) c /= sum;
+    }
+
+    int threads = spec.threads;
+    if (threads <= 0) threads = (int)std::max(1u, std::thread::hardware_concurrency());
+    threads = std::max(1, std::min(threads, n / 4096 + 1));
+
+    auto chunkOf = [&](int t, int& begin, int& end) {
+        begin = (int)((long long)n * t / threads);
+        end   = (int)((long long)n * (t + 1) / threads);
+    };
+
+    std::vector<int> sales(n);
+    std::vector<int> volume(n);
+    std::vector<uint8_t> base(n);
+
+    // Taban isimler bir kez UTF-16'ya çevrilir ("_" dahil)
+    int baseLen[kBaseNameCount];
+    QChar baseChars[kBaseNameCount][24];
+    for (int b = 0; b < kBaseNameCount; ++b) {
+        baseLen[b] = (int)std::strlen(kBaseNames[b]) + 1;
+        for (int k = 0; k + 1 < baseLen[b]; ++k) baseChars[b][k] = QChar(char16_t(kBaseNames[b][k]));
+        baseChars[b][baseLen[b] - 1] = QChar(u'_');
+    }
+
+    // 1) sayısal sütunlar + taban isim seçimi
+    parallelFor(threads, [&](int t) {
+        int begin, end;
+        chunkOf(t, begin, end);
+        for (int i = begin; i < end; ++i) {
+            const uint64_t idx = (uint64_t)i;
+            int v = uniformInt(draw(key, idx, VolumeStream), volumeLo, volumeHi);
+            int s = 0;
+
+            switch (spec.distribution) {
+                case WorkloadSpec::Distribution::ZipfSales: {
+                    const double u = unit(draw(key, idx, SalesStream));
+                    int k = (int)(std::upper_bound(zipfCdf.begin(), zipfCdf.end(), u) - zipfCdf.begin());
+                    s = salesLo + std::min(k, (int)zipfCdf.size() - 1);
+                    break;
+                }
+                case WorkloadSpec::Distribution::Correlated: {
+                    const double vNorm = (volumeHi > volumeLo)
+                                         ? (double)(v - volumeLo) / (volumeHi - volumeLo) : 0.5;
+                    const double noise = unit(draw(key, idx, NoiseStream));
+                    const double mix = spec.correlation * vNorm + (1.0 - spec.correlation) * noise;
+                    s = salesLo + (int)std::lround(mix * (salesHi - salesLo));
+                    break;
+                }
+                default:
+                    s = uniformInt(draw(key, idx, SalesStream), salesLo, salesHi);
+                    break;
+            }
+
+            const int b = uniformInt(draw(key, idx, NameStream), 0, kBaseNameCount - 1);
+            sales[i]  = s;
+            volume[i] = v;
+            base[i]   = (uint8_t)b;
+        }
+    });
+
+    // 2) isim bloğu tek seferde ayrılır
+    // "<ad>_<i+1>"
+    StringPool names;
+    QChar* chars = names.appendUninitialized(n, [&](int i) {
+        return baseLen[base[i]] + decimalDigits((uint32_t)i + 1);
+    });
+
+    // 3) isimler paralel yazılır; her iş parçacığı kendi aralığına
+    parallelFor(threads, [&](int t) {
+        int begin, end;
+        chunkOf(t, begin, end);
+        for (int i = begin; i < end; ++i) {
+            QChar* out = chars + names.charOffset(i);
+            out = std::copy(baseChars[base[i]], baseChars[base[i]] + baseLen[base[i]], out);
+
+            uint32_t x = (uint32_t)i + 1;
+            QChar* last = out + decimalDigits(x) - 1;
+            do {
+                *last-- = QChar(char16_t(u'0' + x % 10));
+                x /= 10;
+            } while (x);
+        }
+    });
+
+    return ProductCatalog::fromColumns(std::move(sales), std::move(volume), std::move(names));
+}
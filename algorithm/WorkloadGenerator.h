@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+
+#include "../model/ProductCatalog.h"
+
+// Sentetik ürün kümesi ayarları. Aynı (seed, ayarlar, count) her zaman
+// bit düzeyinde aynı kataloğu üretir.
+struct WorkloadSpec {
+    enum class Distribution {
+        Uniform,            // satış ve hacim bağımsız, düzgün
+        ZipfSales,          // satış Zipf: çoğu ürün düşük, az ürün çok satar
+        Correlated,         // satış hacimle birlikte artar (+ gürültü)
+        ManyVolumeClasses   // geniş hacim aralığı: çok sayıda farklı hacim sınıfı
+    };
+
+    uint64_t seed = 0x5EED;
+    Distribution distribution = Distribution::Uniform;
+
+    int salesMin = 50;
+    int salesMax = 300;
+    int volumeMin = 1;
+    int volumeMax = 8;
+
+    double zipfExponent = 1.1;    // ZipfSales
+    double correlation = 0.8;     // Correlated: 0 bağımsız, 1 tam bağlı
+    int volumeClasses = 250;      // ManyVolumeClasses: volumeMin.. volumeMin + volumeClasses - 1
+
+    int threads = 0;              // 0: donanım iş parçacığı sayısı
+};
+
+// Sayaç tabanlı RNG: (seed, ürün indeksi, akış) -> SplitMix64.
+// Her ürünün değerleri yalnızca kendi indeksine bağlıdır; bu yüzden sonuç
+// iş parçacığı sayısından bağımsızdır ve N ürünlük küme, daha büyük kümenin
+// ilk N ürünüyle aynıdır.
+class WorkloadGenerator {
+public:
+    static ProductCatalog generate(int count, const WorkloadSpec& spec);
+
+    static const char* distributionName(WorkloadSpec::Distribution d);
+    // "uniform", "zipf", "correlated", "classes"; bilinmiyorsa false
+    static bool parseDistribution(const char* name, WorkloadSpec::Distribution& out);
+};
@@ -0,0 +1,144 @@
+#include "PerfCounters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#endif
+
+// -------------------- Sample
+void PerfCounters::Sample::add(const Sample& o) {
+    for (int e = 0; e < EventCount; ++e) {
+        if (!o.valid[e]) continue;
+        value[e] += o.value[e];
+        valid[e] = true;
+    }
+}
+
+void PerfCounters::Sample::scale(double k) {
+    for (int e = 0; e < EventCount; ++e) value[e] *= k;
+}
+
+bool PerfCounters::Sample::any() const {
+    for (int e = 0; e < EventCount; ++e)
+        if (valid[e]) return true;
+    return false;
+}
+
+// -------------------- PerfCounters
+PerfCounters::PerfCounters() {
+    for (int e = 0; e < EventCount; ++e) fds[e] = -1;
+}
+
+PerfCounters::~PerfCounters() {
+    close();
+}
+
+const char* PerfCounters::eventName(Event e) {
+    switch (e) {
+        case Cycles:       return "cycles";
+        case Instructions: return "instructions";
+        case L1DMisses:    return "l1d_misses";
+        case LLCMisses:    return "llc_misses";
+        case BranchMisses: return "branch_misses";
+        default:           return "?";
+    }
+}
+
+bool PerfCounters::available() const {
+    for (int e = 0; e < EventCount; ++e)
+        if (fds[e] >= 0) return true;
+    return false;
+}
+
+#if defined(__linux__)
+
+static int openEvent(uint32_t type, uint64_t config) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.inherit = 1;   // algoritmanın açtığı iş parçacıkları da sayılır
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0 /* bu süreç */, -1 /* her CPU */, -1, 0);
+}
+
+bool PerfCounters::open() {
+    close();
+
+    const uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D
+                               | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                               | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+    fds[Cycles]       = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    fds[Instructions] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    fds[L1DMisses]    = openEvent(PERF_TYPE_HW_CACHE, l1dReadMiss);
+    fds[LLCMisses]    = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    fds[BranchMisses] = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+
+    if (!available()) {
+        reason = std::string("perf_event_open: ") + std::strerror(errno)
+               + " (/proc/sys/kernel/perf_event_paranoid kontrol edin)";
+        return false;
+    }
+    reason.clear();
+    return true;
+}
+
+void PerfCounters::close() {
+    for (int e = 0; e < EventCount; ++e) {
+        if (fds[e] >= 0) ::close(fds[e]);
+        fds[e] = -1;
+    }
+}
+
+void PerfCounters::start() {
+    for (int e = 0; e < EventCount; ++e) {
+        if (fds[e] < 0) continue;
+        ioctl(fds[e], PERF_EVENT_IOC_RESET, 0);
+        ioctl(fds[e], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+PerfCounters::Sample PerfCounters::stop() {
+    Sample out;
+    for (int e = 0; e < EventCount; ++e) {
+        if (fds[e] >= 0) ioctl(fds[e], PERF_EVENT_IOC_DISABLE, 0);
+    }
+    for (int e = 0; e < EventCount; ++e) {
+        if (fds[e] < 0) continue;
+
+        // value, time_enabled, time_running
+        uint64_t buf[3] = {0, 0, 0};
+        if (::read(fds[e], buf, sizeof(buf)) != (ssize_t)sizeof(buf)) continue;
+        if (buf[2] == 0) continue;   // olay hiç PMU'ya yerleşemedi
+
+        double v = (double)buf[0];
+        if (buf[2] < buf[1]) v *= (double)buf[1] / (double)buf[2];
+        out.value[e] = v;
+        out.valid[e] = true;
+    }
+    return out;
+}
+
+#else
+
+bool PerfCounters::open() {
+    reason = "perf_event_open yalnızca Linux'ta destekleniyor";
+    return false;
+}
+
+void PerfCounters::close() {}
+void PerfCounters::start() {}
+PerfCounters::Sample PerfCounters::stop() { return Sample(); }
+
+#endif
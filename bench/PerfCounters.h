@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+
+// Donanım sayaçları (Linux perf_event_open).
+// Her olay ayrı açılır: desteklenmeyen olay diğerlerini engellemez.
+// Linux dışında ya da izin yoksa available() false döner, ölçüm sessizce atlanır.
+class PerfCounters {
+public:
+    enum Event {
+        Cycles,
+        Instructions,
+        L1DMisses,      // L1 veri önbelleği okuma ıskası
+        LLCMisses,      // son seviye önbellek ıskası
+        BranchMisses,
+        EventCount
+    };
+
+    struct Sample {
+        bool valid[EventCount] = {};
+        double value[EventCount] = {};   // çoklama (multiplex) oranına göre ölçeklenmiş
+
+        // Birden çok çalıştırmanın toplamı için
+        void add(const Sample& o);
+        void scale(double k);
+        bool any() const;
+    };
+
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // En az bir olay açılabildiyse true
+    bool open();
+    void close();
+
+    bool available() const;
+    bool has(Event e) const { return fds[e] >= 0; }
+    // Hiçbir olay açılamadıysa nedeni
+    const std::string& unavailableReason() const { return reason; }
+
+    void start();            // sıfırla + etkinleştir
+    Sample stop();           // durdur + oku
+
+    static const char* eventName(Event e);
+
+private:
+    int fds[EventCount];
+    std::string reason;
+};
@@ -0,0 +1,618 @@
+// Başsız algoritma benchmark'ı.
+// N / raf sayısı / kapasite taraması; her ölçüm için ısınma + tekrar,
+// min / medyan / p95 / ortalama; sonuçlar JSON ve CSV olarak yazılır.
+//
+// Kullanım:
+//   algo_bench [--n 1000,5000] [--shelves 10,50] [--cap 100,500]
+//              [--warmup 2] [--reps 10] [--queries 1000]
+//              [--algos static,greedy,bestfit,dp,dpclasses,dpparallel,search,generate]
+//              [--seed 1] [--dist uniform|zipf|correlated|classes]
+//              [--json sonuc.json] [--csv sonuc.csv] [--no-hw]
+//              [--threads 0] [--bb-time-ms 5000] [--bb-threads 0] [--eps 0.05]
+//              [--ls-ms 50] [--cache-mb 256] [--catalog urunler.whcat|urunler.csv]
+//
+// --catalog verilirse üretilen kataloglar yerine dosyadaki katalog (belleğe
+// eşlenmiş) kullanılır ve --n yok sayılır; .csv önce yanına .whcat olarak
+// dönüştürülür. Açılış (tam doğrulamalı ve güvenilen)
+// ve içe aktarma süreleri ayrı satırlarda raporlanır.
+//
+// "exact" (dal-sınır), "approx" (GCD / FPTAS) ve "greedy+ls" (greedy üzerine
+// süre bütçeli yerel arama) varsayılan listede değildir; --algos ile istenir.
+//
+// Her yerleşim satırı aynı (N, raf, kapasite) için DP toplam satışına oranla
+// raporlanır (vsdp). Referans PlacementCache'ten gelir: "dp" ya da "dpclasses"
+// ölçüldüyse yeniden hesaplanmaz.
+//
+// Linux'ta perf_event_open izin veriyorsa her çalıştırma için donanım
+// sayaçları (cycles, instructions, L1D/LLC ıskası, dal ıskası) da raporlanır;
+// --no-hw ile kapatılır.
+//
+// Global new/delete kancaları bağlı olduğundan her yerleşim için ayrı bir
+// çalıştırmada ayırma sayısı, toplam bayt ve tepe canlı bayt da ölçülür.
+
+#include "../algorithm/WarehouseAlgorithms.h"
+#include "../algorithm/ProductLocationIndex.h"
+#include "../algorithm/DPKernel.h"
+#include "../algorithm/WorkloadGenerator.h"
+#include "../algorithm/PlacementProfile.h"
+#include "../algorithm/AllocationTracker.h"
+#include "../algorithm/PlacementCache.h"
+#include "../algorithm/CatalogFile.h"
+#include "PerfCounters.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// -------------------- config
+struct BenchConfig {
+    std::vector<int> counts   = {1000, 5000, 20000};
+    std::vector<int> shelves  = {10, 50};
+    std::vector<int> caps     = {100, 500};
+    int warmup  = 2;
+    int reps    = 10;
+    int queries = 1000;
+    std::set<std::string> algos = {"static", "greedy", "bestfit", "dp", "dpclasses", "dpparallel", "search", "generate"};
+    WorkloadSpec workload;
+    std::string jsonPath;
+    std::string csvPath;
+    bool hwCounters = true;
+    int threads = 0;                 // dpparallel; 0: donanım sayısı
+    BranchAndBoundOptions bb;
+    ApproxKnapsackOptions approx;
+    LocalSearchOptions localSearch;
+    long long cacheBytes = 256LL << 20;
+    std::string catalogPath;         // boş: generateProducts
+};
+
+static std::vector<int> parseIntList(const std::string& s) {
+    std::vector<int> out;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ','))
+        if (!item.empty()) out.push_back(std::max(1, std::atoi(item.c_str())));
+    return out;
+}
+
+static std::set<std::string> parseNameList(const std::string& s) {
+    std::set<std::string> out;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ','))
+        if (!item.empty()) out.insert(item);
+    return out;
+}
+
+static bool parseArgs(int argc, char** argv, BenchConfig& cfg) {
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        auto next = [&]() -> std::string { return (i + 1 < argc) ? argv[++i] : std::string(); };
+
+        if (a == "--n")            cfg.counts  = parseIntList(next());
+        else if (a == "--shelves") cfg.shelves = parseIntList(next());
+        else if (a == "--cap")     cfg.caps    = parseIntList(next());
+        else if (a == "--warmup")  cfg.warmup  = std::max(0, std::atoi(next().c_str()));
+        else if (a == "--reps")    cfg.reps    = std::max(1, std::atoi(next().c_str()));
+        else if (a == "--queries") cfg.queries = std::max(1, std::atoi(next().c_str()));
+        else if (a == "--algos")   cfg.algos   = parseNameList(next());
+        else if (a == "--json")    cfg.jsonPath = next();
+        else if (a == "--csv")     cfg.csvPath  = next();
+        else if (a == "--no-hw")   cfg.hwCounters = false;
+        else if (a == "--threads")    cfg.threads = std::max(0, std::atoi(next().c_str()));
+        else if (a == "--bb-time-ms") cfg.bb.timeLimitMs = std::max(1, std::atoi(next().c_str()));
+        else if (a == "--bb-threads") cfg.bb.threads     = std::max(0, std::atoi(next().c_str()));
+        else if (a == "--ls-ms")      cfg.localSearch.timeBudgetMs = std::max(1, std::atoi(next().c_str()));
+        else if (a == "--eps")        cfg.approx.epsilon = std::atof(next().c_str());
+        else if (a == "--catalog")    cfg.catalogPath = next();
+        else if (a == "--cache-mb")   cfg.cacheBytes = (long long)std::max(0, std::atoi(next().c_str())) << 20;
+        else if (a == "--seed")    cfg.workload.seed = std::strtoull(next().c_str(), nullptr, 10);
+        else if (a == "--dist") {
+            std::string d = next();
+            if (!WorkloadGenerator::parseDistribution(d.c_str(), cfg.workload.distribution)) {
+                std::fprintf(stderr, "Bilinmeyen dağılım: %s\n", d.c_str());
+                return false;
+            }
+        }
+        else {
+            std::fprintf(stderr, "Bilinmeyen argüman: %s\n", a.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+// -------------------- stats
+struct Stats {
+    double min = 0.0;
+    double median = 0.0;
+    double p95 = 0.0;
+    double mean = 0.0;
+};
+
+static Stats summarize(std::vector<double> samples) {
+    Stats st;
+    if (samples.empty()) return st;
+    std::sort(samples.begin(), samples.end());
+
+    const size_t n = samples.size();
+    st.min    = samples.front();
+    st.median = (n % 2) ? samples[n / 2] : 0.5 * (samples[n / 2 - 1] + samples[n / 2]);
+    st.p95    = samples[std::min(n - 1, (size_t)((n - 1) * 0.95 + 0.5))];
+
+    double sum = 0.0;
+    for (double x : samples) sum += x;
+    st.mean = sum / n;
+    return st;
+}
+
+struct BenchRow {
+    std::string algo;
+    int n = 0;
+    int shelves = 0;
+    int cap = 0;
+    int reps = 0;
+    std::string unit;           // "us" (çalıştırma) ya da "ns" (sorgu başına)
+    Stats time;
+    double efficiency = -1.0;   // yerleşimler için %
+    long long placedSales = -1; // yerleşimler için toplam satış
+    double salesVsDP = -1.0;    // yerleşimler için placedSales / DP toplam satışı (%)
+
+    bool hasProfile = false;    // yerleşimler için son tekrarın faz dökümü
+    PlacementProfile profile;
+
+    PerfCounters::Sample hw;    // çalıştırma başına ortalama donanım sayaçları
+
+    bool hasAlloc = false;      // yerleşimler için tek çalıştırmanın ayırmaları
+    AllocationStats alloc;
+};
+
+// fn'i ısınma + tekrar ile ölç; her örnek mikro saniye.
+// hw verilirse sayaçlar her tekrarı sarar, hwOut'a tekrar başına ortalama yazılır.
+static Stats measureUs(const BenchConfig& cfg, const std::function<void()>& fn,
+                       PerfCounters* hw = nullptr, PerfCounters::Sample* hwOut = nullptr) {
+    for (int i = 0; i < cfg.warmup; ++i) fn();
+
+    const bool counting = hw && hwOut && hw->available();
+    PerfCounters::Sample total;
+
+    std::vector<double> samples;
+    samples.reserve(cfg.reps);
+    for (int i = 0; i < cfg.reps; ++i) {
+        if (counting) hw->start();
+        auto t0 = std::chrono::steady_clock::now();
+        fn();
+        auto t1 = std::chrono::steady_clock::now();
+        if (counting) total.add(hw->stop());
+        samples.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+    }
+
+    if (counting) {
+        total.scale(1.0 / cfg.reps);
+        *hwOut = total;
+    }
+    return summarize(samples);
+}
+
+static long long placedSales(const ShelfLayout& layout, const ProductCatalog& catalog) {
+    long long sum = 0;
+    for (int idx : layout.items) sum += catalog.sales(idx);
+    return sum;
+}
+
+// -------------------- placement
+static void benchPlacements(const BenchConfig& cfg, const ProductCatalog& catalog,
+                            int shelfCount, int shelfCap, PerfCounters* hw,
+                            PlacementCache& cache, uint64_t fingerprint,
+                            std::vector<BenchRow>& rows) {
+    using PlacementFn = std::function<PlacementResult()>;
+    struct Algo { const char* name; PlacementFn run; };
+
+    auto keyOf = [&](PlacementAlgo algo) {
+        PlacementCacheKey key;
+        key.catalog = fingerprint;
+        key.catalogSize = catalog.size();
+        key.algo = algo;
+        key.shelfCount = shelfCount;
+        key.shelfCap = shelfCap;
+        return key;
+    };
+
+    const std::vector<Algo> algos = {
+        {"static",    [&] { return WarehouseAlgorithms::staticPlacement(catalog, shelfCount, shelfCap); }},
+        {"greedy",    [&] { return WarehouseAlgorithms::greedyPlacement(catalog, shelfCount, shelfCap); }},
+        {"bestfit",   [&] { return WarehouseAlgorithms::bestFitDecreasingPlacement(catalog, shelfCount, shelfCap); }},
+        {"dp",        [&] { return WarehouseAlgorithms::dpPlacementKnapsack(catalog, shelfCount, shelfCap).placement; }},
+        {"dpclasses", [&] { return WarehouseAlgorithms::dpPlacementVolumeClasses(catalog, shelfCount, shelfCap).placement; }},
+        {"dpparallel", [&] { return WarehouseAlgorithms::dpPlacementParallel(catalog, shelfCount, shelfCap, cfg.threads); }},
+        {"approx",    [&] { return WarehouseAlgorithms::approxPlacementKnapsack(catalog, shelfCount, shelfCap, cfg.approx).placement; }},
+        {"greedy+ls", [&] {
+            return WarehouseAlgorithms::improvePlacement(
+                    WarehouseAlgorithms::greedyPlacement(catalog, shelfCount, shelfCap), catalog, cfg.localSearch);
+        }},
+        {"exact",     [&] { return WarehouseAlgorithms::exactPlacementBranchAndBound(catalog, shelfCount, shelfCap, cfg.bb).placement; }},
+    };
+
+    const size_t before = rows.size();
+    for (const auto& a : algos) {
+        if (!cfg.algos.count(a.name)) continue;
+
+        PlacementResult last;
+        BenchRow row;
+        row.algo    = a.name;
+        row.n       = catalog.size();
+        row.shelves = shelfCount;
+        row.cap     = shelfCap;
+        row.reps    = cfg.reps;
+        row.unit    = "us";
+        row.time    = measureUs(cfg, [&] { last = a.run(); }, hw, &row.hw);
+
+        // Ayırmalar zamanlamadan ayrı, ek bir çalıştırmada sayılır
+        if (AllocationTracker::installed()) {
+            ScopedAllocationTracking tracking;
+            PlacementResult tracked = a.run();
+            row.alloc    = tracking.stop();
+            row.hasAlloc = true;
+        }
+        row.efficiency  = WarehouseAlgorithms::computeWarehouseEfficiency(last.layout);
+        row.placedSales = placedSales(last.layout, catalog);
+        row.hasProfile  = true;
+        row.profile     = last.profile;
+        rows.push_back(row);
+
+        // DP sonuçları referans olarak saklanır
+        if (row.algo == "dp") cache.store(keyOf(PlacementAlgo::DP), last);
+        else if (row.algo == "dpclasses") cache.store(keyOf(PlacementAlgo::DPVolumeClasses), last);
+    }
+
+    // Referans: aynı raf değeri; ölçülmediyse hacim sınıflı DP ile bir kez hesaplanır
+    if (rows.size() == before) return;
+    PlacementResult ref;
+    if (!cache.lookup(keyOf(PlacementAlgo::DP), ref)) {
+        ref = cache.getOrCompute<PlacementResult>(keyOf(PlacementAlgo::DPVolumeClasses), [&] {
+            return WarehouseAlgorithms::dpPlacementVolumeClasses(catalog, shelfCount, shelfCap).placement;
+        });
+    }
+    const long long refSales = placedSales(ref.layout, catalog);
+    if (refSales <= 0) return;
+    for (size_t i = before; i < rows.size(); ++i)
+        rows[i].salesVsDP = rows[i].placedSales * 100.0 / refSales;
+}
+
+// -------------------- search
+static void benchSearches(const BenchConfig& cfg, const ProductCatalog& catalog,
+                          std::vector<BenchRow>& rows) {
+    // Yarısı katalogda olan, yarısı olmayan sabit sorgu kümesi
+    std::mt19937 rng(2024);
+    std::uniform_int_distribution<int> pick(0, std::max(0, catalog.size() - 1));
+    std::vector<QString> queries;
+    queries.reserve(cfg.queries);
+    for (int q = 0; q < cfg.queries; ++q) {
+        if (q % 2 == 0 && !catalog.empty()) queries.push_back(catalog.name(pick(rng)).toString());
+        else queries.push_back("YOK_" + QString::number(q));
+    }
+
+    auto addRow = [&](const char* name, const std::string& unit, const Stats& st) {
+        BenchRow row;
+        row.algo = name;
+        row.n    = catalog.size();
+        row.reps = cfg.reps;
+        row.unit = unit;
+        row.time = st;
+        rows.push_back(row);
+    };
+
+    // Sorgu başına ns
+    auto perQuery = [&](const std::function<bool(const QString&)>& fn) {
+        int found = 0;
+        Stats st = measureUs(cfg, [&] {
+            for (const auto& q : queries) found += fn(q) ? 1 : 0;
+        });
+        const double scale = 1000.0 / queries.size();
+        st.min *= scale; st.median *= scale; st.p95 *= scale; st.mean *= scale;
+        return st;
+    };
+
+    NameIndex nameIndex;
+    addRow("name_index_build", "us", measureUs(cfg, [&] {
+        nameIndex = WarehouseAlgorithms::buildNameIndex(catalog);
+    }));
+
+    ProductLocationIndex locationIndex;
+    addRow("hash_index_build", "us", measureUs(cfg, [&] {
+        locationIndex.buildCatalog(catalog);
+    }));
+
+    addRow("linear_search", "ns", perQuery([&](const QString& q) {
+        return WarehouseAlgorithms::linearSearchByName(catalog, q).found;
+    }));
+    addRow("binary_search", "ns", perQuery([&](const QString& q) {
+        return WarehouseAlgorithms::binarySearchByName(nameIndex, q).found;
+    }));
+    addRow("hash_search", "ns", perQuery([&](const QString& q) {
+        return WarehouseAlgorithms::hashSearchByName(locationIndex, q).found;
+    }));
+}
+
+// -------------------- output
+static std::string compilerName() {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+static std::string jsonEscape(const std::string& s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') { out += '\\'; out += c; }
+        else if ((unsigned char)c < 0x20) out += ' ';
+        else out += c;
+    }
+    return out;
+}
+
+static void writeJson(const std::string& path, const BenchConfig& cfg, const PerfCounters* hw,
+                      const std::vector<BenchRow>& rows) {
+    FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) {
+        std::fprintf(stderr, "JSON yazılamadı: %s\n", path.c_str());
+        return;
+    }
+
+    std::fprintf(f, "{\n  \"meta\": {\n");
+    std::fprintf(f, "    \"compiler\": \"%s\",\n", jsonEscape(compilerName()).c_str());
+    std::fprintf(f, "    \"dpKernel\": \"%s\",\n", DPKernel::isaName(DPKernel::activeIsa()));
+    std::fprintf(f, "    \"hardwareThreads\": %u,\n", std::thread::hardware_concurrency());
+    std::fprintf(f, "    \"threads\": %d,\n", cfg.threads);
+    std::fprintf(f, "    \"hwCounters\": %s,\n", (hw && hw->available()) ? "true" : "false");
+    if (hw && !hw->unavailableReason().empty())
+        std::fprintf(f, "    \"hwCountersNote\": \"%s\",\n", jsonEscape(hw->unavailableReason()).c_str());
+    std::fprintf(f, "    \"seed\": %llu,\n", (unsigned long long)cfg.workload.seed);
+    std::fprintf(f, "    \"distribution\": \"%s\",\n", WorkloadGenerator::distributionName(cfg.workload.distribution));
+    std::fprintf(f, "    \"warmup\": %d,\n    \"reps\": %d\n  },\n", cfg.warmup, cfg.reps);
+    std::fprintf(f, "  \"results\": [\n");
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const BenchRow& r = rows[i];
+        std::fprintf(f,
+                     "    {\"algo\": \"%s\", \"n\": %d, \"shelves\": %d, \"cap\": %d, \"reps\": %d, "
+                     "\"unit\": \"%s\", \"min\": %.3f, \"median\": %.3f, \"p95\": %.3f, \"mean\": %.3f, "
+                     "\"efficiency\": %.4f, \"placedSales\": %lld, \"salesVsDP\": %.4f",
+                     r.algo.c_str(), r.n, r.shelves, r.cap, r.reps, r.unit.c_str(),
+                     r.time.min, r.time.median, r.time.p95, r.time.mean,
+                     r.efficiency, r.placedSales, r.salesVsDP);
+        if (r.hasProfile) {
+            std::fprintf(f, ", \"phasesUs\": {");
+            for (int k = 0; k < PlacementProfile::kPhaseCount; ++k)
+                std::fprintf(f, "%s\"%s\": %.3f", k ? ", " : "",
+                             PlacementProfile::phaseName((PlacementPhase)k),
+                             r.profile.phaseNs[k] / 1000.0);
+            std::fprintf(f, "}, \"counters\": {");
+            for (int k = 0; k < PlacementProfile::kCounterCount; ++k)
+                std::fprintf(f, "%s\"%s\": %lld", k ? ", " : "",
+                             PlacementProfile::counterName((PlacementCounter)k),
+                             r.profile.counters[k]);
+            std::fprintf(f, "}");
+        }
+        if (r.hasAlloc) {
+            std::fprintf(f, ", \"alloc\": {\"count\": %lld, \"bytes\": %lld, \"peakLiveBytes\": %lld}",
+                         r.alloc.allocations, r.alloc.bytesAllocated, r.alloc.peakLiveBytes);
+        }
+        if (r.hw.any()) {
+            // Açılamayan olaylar null
+            std::fprintf(f, ", \"hw\": {");
+            for (int e = 0; e < PerfCounters::EventCount; ++e) {
+                std::fprintf(f, "%s\"%s\": ", e ? ", " : "", PerfCounters::eventName((PerfCounters::Event)e));
+                if (r.hw.valid[e]) std::fprintf(f, "%.0f", r.hw.value[e]);
+                else std::fprintf(f, "null");
+            }
+            std::fprintf(f, "}");
+        }
+        std::fprintf(f, "}%s\n", (i + 1 < rows.size()) ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    std::fclose(f);
+}
+
+static void writeCsv(const std::string& path, const std::vector<BenchRow>& rows) {
+    FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) {
+        std::fprintf(stderr, "CSV yazılamadı: %s\n", path.c_str());
+        return;
+    }
+
+    std::fprintf(f, "algo,n,shelves,cap,reps,unit,min,median,p95,mean,efficiency,placed_sales,sales_vs_dp");
+    for (int k = 0; k < PlacementProfile::kPhaseCount; ++k)
+        std::fprintf(f, ",%s_us", PlacementProfile::phaseName((PlacementPhase)k));
+    for (int k = 0; k < PlacementProfile::kCounterCount; ++k)
+        std::fprintf(f, ",%s", PlacementProfile::counterName((PlacementCounter)k));
+    for (int e = 0; e < PerfCounters::EventCount; ++e)
+        std::fprintf(f, ",hw_%s", PerfCounters::eventName((PerfCounters::Event)e));
+    std::fprintf(f, ",alloc_count,alloc_bytes,alloc_peak_bytes\n");
+
+    for (const BenchRow& r : rows) {
+        std::fprintf(f, "%s,%d,%d,%d,%d,%s,%.3f,%.3f,%.3f,%.3f,%.4f,%lld,%.4f",
+                     r.algo.c_str(), r.n, r.shelves, r.cap, r.reps, r.unit.c_str(),
+                     r.time.min, r.time.median, r.time.p95, r.time.mean,
+                     r.efficiency, r.placedSales, r.salesVsDP);
+        // Arama satırlarında faz sütunları boş kalır
+        for (int k = 0; k < PlacementProfile::kPhaseCount; ++k) {
+            if (r.hasProfile) std::fprintf(f, ",%.3f", r.profile.phaseNs[k] / 1000.0);
+            else std::fprintf(f, ",");
+        }
+        for (int k = 0; k < PlacementProfile::kCounterCount; ++k) {
+            if (r.hasProfile) std::fprintf(f, ",%lld", r.profile.counters[k]);
+            else std::fprintf(f, ",");
+        }
+        for (int e = 0; e < PerfCounters::EventCount; ++e) {
+            if (r.hw.valid[e]) std::fprintf(f, ",%.0f", r.hw.value[e]);
+            else std::fprintf(f, ",");
+        }
+        if (r.hasAlloc)
+            std::fprintf(f, ",%lld,%lld,%lld\n",
+                         r.alloc.allocations, r.alloc.bytesAllocated, r.alloc.peakLiveBytes);
+        else
+            std::fprintf(f, ",,,\n");
+    }
+    std::fclose(f);
+}
+
+static void printRow(const BenchRow& r) {
+    std::printf("%-18s %8d %7d %6d %12.1f %12.1f %12.1f %3s",
+                r.algo.c_str(), r.n, r.shelves, r.cap,
+                r.time.min, r.time.median, r.time.p95, r.unit.c_str());
+    if (r.efficiency >= 0.0) std::printf("  eff=%.2f%%", r.efficiency);
+    if (r.salesVsDP >= 0.0) std::printf(" vsdp=%.2f%%", r.salesVsDP);
+    std::printf("\n");
+
+    if (r.hasProfile) {
+        // Son tekrarın faz dökümü (µs), sıfır olanlar atlanır
+        std::printf("%-18s", "");
+        for (int k = 0; k < PlacementProfile::kPhaseCount; ++k) {
+            if (r.profile.phaseNs[k] == 0) continue;
+            std::printf(" %s=%.1f", PlacementProfile::phaseName((PlacementPhase)k),
+                        r.profile.phaseNs[k] / 1000.0);
+        }
+        const long long cells = r.profile.counter(PlacementCounter::CellsEvaluated);
+        if (cells > 0) std::printf(" cells=%lld", cells);
+        const long long nodes = r.profile.counter(PlacementCounter::NodesExplored);
+        if (nodes > 0) std::printf(" nodes=%lld", nodes);
+        if (r.hasAlloc)
+            std::printf(" allocs=%lld bytes=%.1fKB peak=%.1fKB", r.alloc.allocations,
+                        r.alloc.bytesAllocated / 1024.0, r.alloc.peakLiveBytes / 1024.0);
+        std::printf("\n");
+    }
+
+    if (r.hw.any()) {
+        const auto& h = r.hw;
+        std::printf("%-18s", "");
+        if (h.valid[PerfCounters::Cycles] && h.valid[PerfCounters::Instructions] && h.value[PerfCounters::Cycles] > 0)
+            std::printf(" ipc=%.2f", h.value[PerfCounters::Instructions] / h.value[PerfCounters::Cycles]);
+        for (int e = 0; e < PerfCounters::EventCount; ++e) {
+            if (!h.valid[e]) continue;
+            std::printf(" %s=%.3gM", PerfCounters::eventName((PerfCounters::Event)e), h.value[e] / 1e6);
+        }
+        std::printf("\n");
+    }
+    std::fflush(stdout);
+}
+
+// -------------------- main
+int main(int argc, char** argv) {
+    BenchConfig cfg;
+    if (!parseArgs(argc, argv, cfg)) return 2;
+
+    PerfCounters hw;
+    if (cfg.hwCounters && !hw.open())
+        std::fprintf(stderr, "Donanım sayaçları kullanılamıyor: %s\n", hw.unavailableReason().c_str());
+
+    std::printf("%-18s %8s %7s %6s %12s %12s %12s\n",
+                "algo", "n", "shelves", "cap", "min", "median", "p95");
+
+    PlacementCache cache(cfg.cacheBytes);
+
+    std::vector<BenchRow> rows;
+
+    // Dosyadan katalog: tek "N"; açılış (ve CSV ise içe aktarma) ölçülür
+    ProductCatalog fileCatalog;
+    std::vector<int> counts = cfg.counts;
+    if (!cfg.catalogPath.empty()) {
+        QString path = QString::fromStdString(cfg.catalogPath);
+        QString error;
+        const std::string suffix = ".csv";
+        if (cfg.catalogPath.size() > suffix.size()
+            && cfg.catalogPath.compare(cfg.catalogPath.size() - suffix.size(), suffix.size(), suffix) == 0) {
+            const QString csvPath = path;
+            path = QString::fromStdString(cfg.catalogPath.substr(0, cfg.catalogPath.size() - suffix.size()) + ".whcat");
+
+            CsvImportStats st;
+            if (!CatalogFile::importCsv(csvPath, path, CsvImportOptions(), &st, &error)) {
+                std::fprintf(stderr, "CSV içe aktarılamadı: %s\n", error.toStdString().c_str());
+                return 1;
+            }
+            BenchRow row;
+            row.algo = "csv_import";
+            row.n    = (int)st.rows;
+            row.reps = 1;
+            row.unit = "us";
+            row.time = summarize({(double)st.elapsedMs * 1000.0});
+            rows.push_back(row);
+            printRow(row);
+        }
+
+        if (!CatalogFile::open(path, fileCatalog, &error)) {
+            std::fprintf(stderr, "Katalog açılamadı: %s\n", error.toStdString().c_str());
+            return 1;
+        }
+        // Tam doğrulamalı (O(n)) ve güvenilen (yalnızca başlık) açılış ayrı satırlar
+        for (const bool trusted : {false, true}) {
+            BenchRow row;
+            row.algo = trusted ? "catalog_open_trusted" : "catalog_open";
+            row.n    = fileCatalog.size();
+            row.reps = cfg.reps;
+            row.unit = "us";
+            row.time = measureUs(cfg, [&] {
+                ProductCatalog c;
+                if (trusted) CatalogFile::openTrusted(path, c);
+                else         CatalogFile::open(path, c);
+            });
+            rows.push_back(row);
+            printRow(row);
+        }
+        counts = {fileCatalog.size()};
+    }
+
+    for (int n : counts) {
+        // Aynı N için tüm algoritmalar ve tekrarlar aynı veriyi görür;
+        // tohum sabit olduğundan çalıştırmalar arasında da aynı
+        const ProductCatalog catalog = cfg.catalogPath.empty()
+                ? WarehouseAlgorithms::generateProducts(n, cfg.workload)
+                : fileCatalog;
+        const uint64_t fingerprint = PlacementCache::fingerprint(catalog);
+
+        if (cfg.algos.count("generate") && cfg.catalogPath.empty()) {
+            BenchRow row;
+            row.algo = "generate";
+            row.n    = n;
+            row.reps = cfg.reps;
+            row.unit = "us";
+            row.time = measureUs(cfg, [&] { WarehouseAlgorithms::generateProducts(n, cfg.workload); });
+            rows.push_back(row);
+            printRow(row);
+        }
+
+        for (int m : cfg.shelves) {
+            for (int cap : cfg.caps) {
+                size_t before = rows.size();
+                benchPlacements(cfg, catalog, m, cap, &hw, cache, fingerprint, rows);
+                for (size_t i = before; i < rows.size(); ++i) printRow(rows[i]);
+            }
+        }
+
+        if (cfg.algos.count("search")) {
+            size_t before = rows.size();
+            benchSearches(cfg, catalog, rows);
+            for (size_t i = before; i < rows.size(); ++i) printRow(rows[i]);
+        }
+    }
+
+    const PlacementCacheStats& cs = cache.stats();
+    std::printf("referans önbelleği: %d sonuç, %.1f KB, isabet %lld / ıska %lld, atılan %lld\n",
+                cs.entries, cs.bytes / 1024.0, cs.hits, cs.misses, cs.evictions);
+
+    if (!cfg.jsonPath.empty()) writeJson(cfg.jsonPath, cfg, &hw, rows);
+    if (!cfg.csvPath.empty())  writeCsv(cfg.csvPath, rows);
+    return 0;
+}
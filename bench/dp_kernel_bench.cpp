@@ -0,0 +1,94 @@
+// DP satır çekirdeği mikro benchmark'ı: her ISA yolu için satır başına süre
+// ve skaler yola göre hızlanma.
+//
+// Kullanım: dp_kernel_bench [rows] [cap1 cap2 ...]
+
+#include "../algorithm/DPKernel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+struct KernelRun {
+    double nsPerRow = 0.0;
+    long long checksum = 0;
+};
+
+static KernelRun runKernel(DPKernel::RowUpdateFn fn, const std::vector<int>& w,
+                           const std::vector<int>& v, int capacity) {
+    const int rows = (int)w.size();
+    const int words = (capacity + 1 + 63) / 64;
+
+    std::vector<int> row(capacity + 1, 0);
+    std::vector<uint64_t> bits((size_t)words, 0);
+
+    // ısınma
+    for (int i = 0; i < std::min(rows, 64); ++i)
+        fn(row.data(), bits.data(), capacity, w[i], v[i]);
+    std::fill(row.begin(), row.end(), 0);
+
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t bitHash = 0;
+    for (int i = 0; i < rows; ++i) {
+        std::fill(bits.begin(), bits.end(), 0ULL);
+        fn(row.data(), bits.data(), capacity, w[i], v[i]);
+        for (uint64_t b : bits) bitHash = bitHash * 1099511628211ULL + b;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    KernelRun r;
+    r.nsPerRow = std::chrono::duration<double, std::nano>(t1 - t0).count() / rows;
+    r.checksum = (long long)row[capacity] ^ (long long)bitHash;
+    return r;
+}
+
+int main(int argc, char** argv) {
+    int rows = 5000;
+    std::vector<int> caps = {64, 500, 4096, 65536};
+    if (argc > 1) rows = std::max(1, std::atoi(argv[1]));
+    if (argc > 2) {
+        caps.clear();
+        for (int i = 2; i < argc; ++i) caps.push_back(std::max(1, std::atoi(argv[i])));
+    }
+
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> salesDist(50, 300);
+    std::uniform_int_distribution<int> volumeDist(1, 8);
+    std::vector<int> w(rows), v(rows);
+    for (int i = 0; i < rows; ++i) {
+        w[i] = volumeDist(rng);
+        v[i] = salesDist(rng);
+    }
+
+    const DPKernel::Isa isas[] = {DPKernel::Isa::Scalar, DPKernel::Isa::SSE41, DPKernel::Isa::AVX2};
+
+    std::printf("Aktif çekirdek: %s | satır: %d\n", DPKernel::isaName(DPKernel::activeIsa()), rows);
+    std::printf("%-8s %10s %14s %14s %10s\n", "ISA", "Kapasite", "ns/satir", "hucre/ns", "hizlanma");
+
+    for (int cap : caps) {
+        double scalarNs = 0.0;
+        long long scalarSum = 0;
+        for (auto isa : isas) {
+            auto fn = DPKernel::kernelFor(isa);
+            if (!fn) {
+                std::printf("%-8s %10d %14s\n", DPKernel::isaName(isa), cap, "desteklenmiyor");
+                continue;
+            }
+            KernelRun r = runKernel(fn, w, v, cap);
+            if (isa == DPKernel::Isa::Scalar) {
+                scalarNs  = r.nsPerRow;
+                scalarSum = r.checksum;
+            } else if (r.checksum != scalarSum) {
+                std::printf("HATA: %s sonucu skaler yoldan farkli\n", DPKernel::isaName(isa));
+                return 1;
+            }
+            std::printf("%-8s %10d %14.1f %14.2f %9.2fx\n",
+                        DPKernel::isaName(isa), cap, r.nsPerRow,
+                        (cap + 1) / r.nsPerRow, scalarNs / r.nsPerRow);
+        }
+    }
+    return 0;
+}
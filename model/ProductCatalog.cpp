@@ -0,0 +1,85 @@
+#include "ProductCatalog.h"
+
+#include <algorithm>
+#include <numeric>
+
+void ProductCatalog::reserve(int count) {
+    detach();
+    salesCol.reserve(count);
+    volumeCol.reserve(count);
+    nameCol.reserve(count);
+}
+
+void ProductCatalog::clear() {
+    borrowed.reset();
+    salesCol.clear();
+    volumeCol.clear();
+    nameCol.clear();
+    pool.clear();
+}
+
+int ProductCatalog::add(QStringView name, int sales, int volume) {
+    detach();
+    salesCol.push_back(sales);
+    volumeCol.push_back(volume);
+    nameCol.push_back(pool.intern(name));
+    return size() - 1;
+}
+
+Product ProductCatalog::product(int i) const {
+    Product p;
+    p.name   = name(i).toString();
+    p.sales  = sales(i);
+    p.volume = volume(i);
+    return p;
+}
+
+ProductCatalog ProductCatalog::fromProducts(const std::vector<Product>& products) {
+    ProductCatalog c;
+    c.reserve((int)products.size());
+    for (const auto& p : products) c.add(p);
+    return c;
+}
+
+ProductCatalog ProductCatalog::fromColumns(std::vector<int> sales, std::vector<int> volume, StringPool names) {
+    ProductCatalog c;
+    const int n = (int)sales.size();
+    c.salesCol  = std::move(sales);
+    c.volumeCol = std::move(volume);
+    c.pool      = std::move(names);
+    c.nameCol.resize(n);
+    for (int i = 0; i < n; ++i) c.nameCol[i] = i;
+    return c;
+}
+
+ProductCatalog ProductCatalog::fromBorrowed(BorrowedCatalogColumns columns) {
+    ProductCatalog c;
+    c.borrowed = std::make_shared<const BorrowedCatalogColumns>(std::move(columns));
+    return c;
+}
+
+void ProductCatalog::detach() {
+    if (!borrowed) return;
+    const std::shared_ptr<const BorrowedCatalogColumns> hold = std::move(borrowed);
+    const BorrowedCatalogColumns& b = *hold;
+    const int n = b.count;
+
+    salesCol.assign(b.sales, b.sales + n);
+    volumeCol.assign(b.volume, b.volume + n);
+
+    // İsim bloğu tek kopyayla; kimlikler sıra ile aynı
+    pool.clear();
+    const int64_t* off = b.nameOffsets;
+    QChar* chars = pool.appendUninitialized(n, [&](int i) { return (qsizetype)(off[i + 1] - off[i]); });
+    std::copy(b.names + off[0], b.names + off[n], chars);
+
+    nameCol.resize(n);
+    std::iota(nameCol.begin(), nameCol.end(), 0);
+}
+
+std::vector<Product> ProductCatalog::toProducts() const {
+    std::vector<Product> out;
+    out.reserve(size());
+    for (int i = 0; i < size(); ++i) out.push_back(product(i));
+    return out;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <QString>
+#include <QStringView>
+
+#include "Product.h"
+#include "StringPool.h"
+
+// Dışarıda tutulan salt okunur sütunlar (ör. belleğe eşlenmiş katalog dosyası).
+// i. ürünün ismi names[nameOffsets[i], nameOffsets[i + 1]).
+// keepAlive, işaretçiler geçerli kaldığı sürece tutulur.
+struct BorrowedCatalogColumns {
+    int count = 0;
+    const int* sales = nullptr;
+    const int* volume = nullptr;
+    const int64_t* nameOffsets = nullptr;   // count + 1 eleman
+    const QChar* names = nullptr;
+    std::shared_ptr<const void> keepAlive;
+};
+
+// Sütun tabanlı (structure-of-arrays) ürün kataloğu.
+// Satış ve hacim bitişik int dizilerinde, isimler interned havuzda tutulur;
+// algoritmalar ürünleri indeksle gezer, Product kopyalamaz.
+// Ödünç sütunlu katalog kopyalanınca sütunlar paylaşılır; ilk değişiklikte
+// (add / setSales / reserve) sütunlar bir kez kendi dizilerine kopyalanır.
+class ProductCatalog {
+public:
+    int size() const { return borrowed ? borrowed->count : (int)salesCol.size(); }
+    bool empty() const { return size() == 0; }
+
+    void reserve(int count);
+    void clear();
+
+    // Eklenen ürünün indeksini döndürür
+    int add(QStringView name, int sales, int volume);
+    int add(const Product& p) { return add(p.name, p.sales, p.volume); }
+
+    int sales(int i) const  { return salesData()[i]; }
+    void setSales(int i, int sales) { detach(); salesCol[i] = sales; }
+    int volume(int i) const { return volumeData()[i]; }
+    QStringView name(int i) const {
+        if (!borrowed) return pool.view(nameCol[i]);
+        const int64_t* off = borrowed->nameOffsets;
+        return QStringView(borrowed->names + off[i], (qsizetype)(off[i + 1] - off[i]));
+    }
+
+    const int* salesData() const  { return borrowed ? borrowed->sales : salesCol.data(); }
+    const int* volumeData() const { return borrowed ? borrowed->volume : volumeCol.data(); }
+
+    // Ödünç sütunlu katalogda boştur (isimler name() ile okunur)
+    const StringPool& names() const { return pool; }
+    bool isBorrowed() const { return borrowed != nullptr; }
+
+    // Tek ürünü değer olarak üret (UI / dönüşüm için)
+    Product product(int i) const;
+
+    static ProductCatalog fromProducts(const std::vector<Product>& products);
+    // Hazır sütunlardan: names.size() == sales.size(), i. ürünün ismi i. kimlik
+    static ProductCatalog fromColumns(std::vector<int> sales, std::vector<int> volume, StringPool names);
+    // Kopyalamadan dış sütunlar üzerinde; isimler tekilleştirilmez
+    static ProductCatalog fromBorrowed(BorrowedCatalogColumns columns);
+    std::vector<Product> toProducts() const;
+
+private:
+    // Ödünç sütunları kendi dizilerine kopyala (değilse bir şey yapmaz)
+    void detach();
+
+    std::shared_ptr<const BorrowedCatalogColumns> borrowed;
+    std::vector<int> salesCol;
+    std::vector<int> volumeCol;
+    std::vector<int> nameCol;
+    StringPool pool;
+};
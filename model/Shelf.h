@@ -1,9 +1,13 @@
 #pragma once
-#include <vector>
-#include "Product.h"
 
+// Tek rafın hafif görünümü: ürünler katalog indeksleri olarak tutulur,
+// Product kopyalanmaz. ShelfLayout yaşadığı sürece geçerlidir.
 struct Shelf {
     int capacity = 0;
     int used = 0;
-    std::vector<Product> products;
+    const int* items = nullptr;   // katalog indeksleri
+    int count = 0;
+
+    const int* begin() const { return items; }
+    const int* end() const { return items + count; }
 };
@@ -0,0 +1,47 @@
+#include "ShelfLayout.h"
+
+#include <algorithm>
+
+// -------------------- ShelfLayout
+int ShelfLayout::maxItemsPerShelf() const {
+    int best = 0;
+    for (int s = 0; s < shelfCount(); ++s) best = std::max(best, itemCount(s));
+    return best;
+}
+
+void ShelfLayout::clear() {
+    capacity.clear();
+    used.clear();
+    offsets.clear();
+    items.clear();
+}
+
+// -------------------- ShelfLayoutBuilder
+void ShelfLayoutBuilder::reset(int shelfCount, int shelfCap) {
+    capacity = shelfCap;
+    usedOf.assign(std::max(0, shelfCount), 0);
+    shelfOf.clear();
+    itemOf.clear();
+}
+
+ShelfLayout ShelfLayoutBuilder::finish() {
+    const int m = (int)usedOf.size();
+
+    ShelfLayout out;
+    out.capacity.assign(m, capacity);
+    out.used = usedOf;
+
+    // Rafa göre kararlı counting sort
+    out.offsets.assign(m + 1, 0);
+    for (int s : shelfOf) out.offsets[s + 1]++;
+    for (int s = 0; s < m; ++s) out.offsets[s + 1] += out.offsets[s];
+
+    out.items.resize(itemOf.size());
+    std::vector<int> pos(out.offsets.begin(), out.offsets.end() - 1);
+    for (size_t k = 0; k < itemOf.size(); ++k)
+        out.items[pos[shelfOf[k]]++] = itemOf[k];
+
+    shelfOf.clear();
+    itemOf.clear();
+    return out;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <vector>
+
+#include "Shelf.h"
+
+// Yerleşimin sıkıştırılmış gösterimi: tüm raflar tek düz indeks dizisinde.
+// Raf s'nin ürünleri: items[offsets[s], offsets[s + 1])
+struct ShelfLayout {
+    std::vector<int> capacity;   // raf başına
+    std::vector<int> used;       // raf başına
+    std::vector<int> offsets;    // shelfCount() + 1
+    std::vector<int> items;      // katalog indeksleri
+
+    int shelfCount() const { return (int)capacity.size(); }
+    int itemCount() const { return (int)items.size(); }
+    int itemCount(int s) const { return offsets[s + 1] - offsets[s]; }
+    int maxItemsPerShelf() const;
+
+    Shelf shelf(int s) const {
+        Shelf v;
+        v.capacity = capacity[s];
+        v.used     = used[s];
+        v.items    = items.data() + offsets[s];
+        v.count    = itemCount(s);
+        return v;
+    }
+
+    bool empty() const { return capacity.empty(); }
+    void clear();
+};
+
+// Yerleşim sırasında (raf, ürün) atamalarını toplar; finish() ile
+// raf sırasını ve raf içi ekleme sırasını koruyarak düz diziye çevirir.
+class ShelfLayoutBuilder {
+public:
+    void reset(int shelfCount, int shelfCap);
+
+    void place(int shelf, int item, int volume) {
+        shelfOf.push_back(shelf);
+        itemOf.push_back(item);
+        usedOf[shelf] += volume;
+    }
+
+    int used(int shelf) const { return usedOf[shelf]; }
+
+    ShelfLayout finish();
+
+private:
+    int capacity = 0;
+    std::vector<int> usedOf;
+    std::vector<int> shelfOf;
+    std::vector<int> itemOf;
+};
@@ -0,0 +1,63 @@
+#include "StringPool.h"
+
+#include <QHash>
+
+// -------------------- append / intern
+int StringPool::append(QStringView s) {
+    chars.insert(chars.end(), s.begin(), s.end());
+    offsets.push_back((qsizetype)chars.size());
+    return size() - 1;
+}
+
+int StringPool::intern(QStringView s) {
+    // append ile eklenip henüz tabloya girmemiş kimlikleri de kapsa
+    if ((size_t)(size() + 1) * 2 > slots.size())
+        rehash(std::max<size_t>(64, slots.size() * 2));
+    else
+        rehash(slots.size());
+
+    const size_t h = qHash(s);
+    int slot = findSlot(s, h);
+    if (slots[slot] >= 0) return slots[slot];
+
+    int id = append(s);
+    slots[slot] = id;
+    hashed = size();
+    return id;
+}
+
+// -------------------- hash table
+int StringPool::findSlot(QStringView s, size_t hash) const {
+    const size_t mask = slots.size() - 1;
+    size_t i = hash & mask;
+    while (slots[i] >= 0 && view(slots[i]) != s)
+        i = (i + 1) & mask;
+    return (int)i;
+}
+
+void StringPool::rehash(size_t slotCount) {
+    while ((size_t)size() * 2 > slotCount) slotCount *= 2;
+
+    if (slotCount != slots.size()) {
+        slots.assign(slotCount, -1);
+        hashed = 0;
+    }
+    for (; hashed < size(); ++hashed) {
+        QStringView s = view(hashed);
+        int slot = findSlot(s, qHash(s));
+        if (slots[slot] < 0) slots[slot] = hashed;
+    }
+}
+
+// -------------------- misc
+void StringPool::reserve(int strings, qsizetype totalChars) {
+    offsets.reserve((size_t)strings + 1);
+    chars.reserve((size_t)totalChars);
+}
+
+void StringPool::clear() {
+    chars.clear();
+    offsets.assign(1, 0);
+    slots.clear();
+    hashed = 0;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <vector>
+#include <QString>
+#include <QStringView>
+
+// Interned isim havuzu: tüm karakterler tek bitişik blokta tutulur,
+// aynı isim yalnızca bir kez saklanır. Kimlikler 0'dan başlar.
+class StringPool {
+public:
+    // Varsa mevcut kimliği, yoksa yeni kimliği döndürür
+    int intern(QStringView s);
+
+    // Tekilleştirme yapmadan ekle (isimlerin zaten tekil olduğu biliniyorsa)
+    int append(QStringView s);
+
+    // Tekilleştirmesiz toplu ekleme: count isim için lengthOf(k) uzunluğunda yer açar.
+    // Dönen blok ilk yeni ismin başıdır; k. isim charOffset(ilkKimlik + k)'dan başlar.
+    // Karakterler çağıran tarafından (paralel de olabilir) yazılır.
+    template <typename LengthFn>
+    QChar* appendUninitialized(int count, LengthFn lengthOf) {
+        const qsizetype start = (qsizetype)chars.size();
+        qsizetype end = start;
+        offsets.reserve(offsets.size() + (size_t)count);
+        for (int k = 0; k < count; ++k) {
+            end += (qsizetype)lengthOf(k);
+            offsets.push_back(end);
+        }
+        chars.resize((size_t)end);
+        return chars.data() + start;
+    }
+
+    qsizetype charOffset(int id) const { return offsets[id]; }
+
+    QStringView view(int id) const {
+        return QStringView(chars.data() + offsets[id], offsets[id + 1] - offsets[id]);
+    }
+
+    int size() const { return (int)offsets.size() - 1; }
+    qsizetype charCount() const { return (qsizetype)chars.size(); }
+
+    void reserve(int strings, qsizetype totalChars);
+    void clear();
+
+private:
+    void rehash(size_t slotCount);
+    int findSlot(QStringView s, size_t hash) const;
+
+    std::vector<QChar> chars;
+    std::vector<qsizetype> offsets = {0};   // size() + 1 eleman
+    std::vector<int> slots;                 // açık adresleme: kimlik ya da -1
+    int hashed = 0;                         // tabloya girmiş kimlik sayısı
+};
@@ -1,5 +1,11 @@
 #include "MainWindow.h"
+#include "PerformanceWorker.h"
 #include "../algorithm/WarehouseAlgorithms.h"
+#include "../algorithm/AllocationTracker.h"
+#include "../algorithm/AsciiMapWriter.h"
+#include "../algorithm/PlacementEngine.h"
+#include "../algorithm/CatalogFile.h"
+#include "../algorithm/VolumeClassKnapsack.h"
 
 #include <QVBoxLayout>
 #include <QHBoxLayout>
@@ -7,14 +13,27 @@
 #include <QStatusBar>
 #include <QSplitter>
 #include <QAbstractItemView>
-#include <QTableWidgetItem>
 #include <QDialog>
 #include <QPainter>
+#include <QCheckBox>
+#include <QSpinBox>
+#include <QDoubleSpinBox>
+#include <QProgressBar>
+#include <QThread>
+#include <QTimer>
+#include <QPointer>
+#include <QPlainTextEdit>
+#include <QFileDialog>
+#include <QFileInfo>
 #include <algorithm>
+#include <memory>
+#include <cstring>
+#include <random>
 
 #include <QtCharts/QChart>
 #include <QtCharts/QLineSeries>
 #include <QtCharts/QValueAxis>
+#include <QtCharts/QLogValueAxis>
 #include <QtCharts/QChartView>
 #include <QtCharts/QBarSeries>
 #include <QtCharts/QBarSet>
@@ -27,6 +46,51 @@
 #include <QGroupBox>
 
 
+// Faz dökümü: sıfır olmayan fazlar toplam süreye oranla, ardından sayaçlar
+static QString profileText(const PlacementProfile& p) {
+    QString out = "\nFaz dökümü:";
+    const double total = std::max<long long>(1, p.totalNs);
+    for (int i = 0; i < PlacementProfile::kPhaseCount; ++i) {
+        const auto ph = (PlacementPhase)i;
+        if (p.phase(ph) == 0) continue;
+        out += QString("\n  %1: %2 µs (%%3)")
+                .arg(PlacementProfile::phaseName(ph), -12)
+                .arg(p.phase(ph) / 1000.0, 0, 'f', 1)
+                .arg(p.phase(ph) * 100.0 / total, 0, 'f', 1);
+    }
+    for (int i = 0; i < PlacementProfile::kCounterCount; ++i) {
+        const auto c = (PlacementCounter)i;
+        if (p.counter(c) == 0) continue;
+        out += QString("\n  %1: %2").arg(PlacementProfile::counterName(c), -12).arg(p.counter(c));
+    }
+    return out;
+}
+
+// Kesin DP: karar bitleri + kontrol noktası satırları ~ n * (C + 1) / 4 bayt
+static constexpr long long kDPTableLimitBytes = 256LL << 20;
+
+static bool dpTableFits(QWidget* parent, int n, int shelfCap) {
+    const long long bytes = (long long)n * (shelfCap + 1) / 4;
+    if (bytes <= kDPTableLimitBytes) return true;
+    QMessageBox::warning(parent, "Uyarı",
+                         QString("Kesin DP tablosu yaklaşık %1 MB tutar.\n"
+                                 "Büyük kapasiteler için \"Yaklaşık DP (FPTAS)\" kullanın.")
+                                 .arg(bytes >> 20));
+    return false;
+}
+
+// Hacim sınıfı DP: raf başına sınıf * (C + 1) seçim tablosu (Kesin aramanın tohumu da bu)
+static bool volumeClassTableFits(QWidget* parent, const ProductCatalog& catalog, int shelfCap) {
+    const long long bytes = VolumeClassKnapsack::choiceTableBytes(
+            catalog.volumeData(), catalog.salesData(), catalog.size(), shelfCap);
+    if (bytes <= kDPTableLimitBytes) return true;
+    QMessageBox::warning(parent, "Uyarı",
+                         QString("Hacim sınıfı DP tablosu yaklaşık %1 MB tutar.\n"
+                                 "Büyük kapasiteler için \"Yaklaşık DP (FPTAS)\" kullanın.")
+                                 .arg(bytes >> 20));
+    return false;
+}
+
 static QString actionBtnStyle() {
     return R"(
         QPushButton {
@@ -74,14 +138,15 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
     searchEdit->setMinimumHeight(36);
 
     searchTypeCombo = new QComboBox;
-    searchTypeCombo->addItems({"Linear Search O(n)", "Binary Search O(log n)"});
+    searchTypeCombo->addItems({"Linear Search O(n)", "Binary Search O(log n)", "Hash Index O(1)"});
     searchTypeCombo->setMinimumHeight(36);
 
     btnSearch = new QPushButton("Ara");
     applyButton(btnSearch);
 
     algoCombo = new QComboBox;
-    algoCombo->addItems({"Statik", "Greedy", "DP (Knapsack)"});
+    algoCombo->addItems({"Statik", "Greedy", "DP (Knapsack)", "DP (Hacim Sınıfı)", "Best-Fit (Satış/Hacim)",
+                         "Kesin (Branch&Bound)", "Yaklaşık DP (FPTAS)", "DP (Paralel Raf)"});
     algoCombo->setMinimumHeight(36);
 
     btnRun = new QPushButton("Çalıştır");
@@ -99,12 +164,31 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
 
     spProductCount = new QSpinBox; spProductCount->setRange(10, 5000); spProductCount->setValue(40);
     spShelfCount   = new QSpinBox; spShelfCount->setRange(1, 50);      spShelfCount->setValue(5);
-    spShelfCap     = new QSpinBox; spShelfCap->setRange(5, 500);       spShelfCap->setValue(20);
+    spShelfCap     = new QSpinBox; spShelfCap->setRange(5, 1000000);   spShelfCap->setValue(20);
+
+    spSeed         = new QSpinBox; spSeed->setRange(0, 999999);        spSeed->setValue(1);
 
-    for (auto* s : {spProductCount, spShelfCount, spShelfCap}) s->setMinimumHeight(36);
+    for (auto* s : {spProductCount, spShelfCount, spShelfCap, spSeed}) s->setMinimumHeight(36);
+
+    // FPTAS hata payı: raf başına değer >= (1 - ε) * kesin
+    spEpsilon = new QDoubleSpinBox;
+    spEpsilon->setRange(0.005, 0.5);
+    spEpsilon->setSingleStep(0.01);
+    spEpsilon->setDecimals(3);
+    spEpsilon->setValue(0.05);
+    spEpsilon->setMinimumHeight(36);
+
+    // Sıra WorkloadSpec::Distribution ile aynı
+    distCombo = new QComboBox;
+    distCombo->addItems({"Düzgün", "Zipf Satış", "Hacim-Satış İlişkili", "Çok Hacim Sınıfı"});
+    distCombo->setMinimumHeight(36);
 
     btnGenerate = new QPushButton("Yeni Ürün Seti");
     applyButton(btnGenerate);
+    btnOpenCatalog = new QPushButton("Katalog Aç");
+    applyButton(btnOpenCatalog);
+    btnSaveCatalog = new QPushButton("Katalog Kaydet");
+    applyButton(btnSaveCatalog);
 
     param->addWidget(new QLabel("Ürün"));
     param->addWidget(spProductCount);
@@ -114,10 +198,24 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
     param->addSpacing(10);
     param->addWidget(new QLabel("Kapasite"));
     param->addWidget(spShelfCap);
+    param->addSpacing(10);
+    param->addWidget(new QLabel("ε"));
+    param->addWidget(spEpsilon);
+    param->addSpacing(10);
+    param->addWidget(new QLabel("Tohum"));
+    param->addWidget(spSeed);
+    param->addSpacing(10);
+    param->addWidget(new QLabel("Dağılım"));
+    param->addWidget(distCombo);
     param->addStretch();
     param->addWidget(btnGenerate);
+    param->addWidget(btnOpenCatalog);
+    param->addWidget(btnSaveCatalog);
 
-    table = new QTableWidget;
+    // Sanal tablo: hücreler görünür oldukça modelden üretilir
+    shelfModel = new ShelfTableModel(this);
+    table = new QTableView;
+    table->setModel(shelfModel);
     table->setEditTriggers(QAbstractItemView::NoEditTriggers);
     table->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
     table->setMinimumHeight(380);
@@ -139,14 +237,28 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
     btnComplexity  = new QPushButton("Depo Verimliliği");
     btnPerformance = new QPushButton("Algoritmaların Çalışma Süresi Karşılaştırması");
     btnAscii       = new QPushButton("ASCII Depo");
+    btnImprove     = new QPushButton("Yerel Arama ile İyileştir");
+    btnStream      = new QPushButton("Ürün Akışı");
+
+    // Yerel arama süre bütçesi (ms)
+    spImproveBudget = new QSpinBox;
+    spImproveBudget->setRange(1, 60000);
+    spImproveBudget->setValue(200);
+    spImproveBudget->setSuffix(" ms");
+    spImproveBudget->setMinimumHeight(36);
 
     applyButton(btnComplexity);
     applyButton(btnPerformance);
     applyButton(btnAscii);
+    applyButton(btnImprove);
+    applyButton(btnStream);
 
     bottom->addWidget(btnComplexity);
     bottom->addWidget(btnPerformance);
     bottom->addWidget(btnAscii);
+    bottom->addWidget(btnImprove);
+    bottom->addWidget(spImproveBudget);
+    bottom->addWidget(btnStream);
 
     root->addLayout(top);
     root->addLayout(param);
@@ -154,137 +266,223 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
     root->addLayout(bottom);
 
     connect(btnGenerate, &QPushButton::clicked, this, &MainWindow::regenerateProducts);
+    connect(btnOpenCatalog, &QPushButton::clicked, this, &MainWindow::openCatalog);
+    connect(btnSaveCatalog, &QPushButton::clicked, this, &MainWindow::saveCatalog);
     connect(btnSearch,   &QPushButton::clicked, this, &MainWindow::runSearch);
 
     connect(btnRun, &QPushButton::clicked, this, [this]{
         int idx = algoCombo->currentIndex();
         if (idx == 0) runStatic();
         else if (idx == 1) runGreedy();
-        else runDP();
+        else if (idx == 2) runDP();
+        else if (idx == 3) runDPVolumeClasses();
+        else if (idx == 4) runBestFit();
+        else if (idx == 5) runExact();
+        else if (idx == 6) runApprox();
+        else runDPParallel();
     });
 
     connect(btnComplexity,  &QPushButton::clicked, this, &MainWindow::runDepotEfficiency);
     connect(btnPerformance, &QPushButton::clicked, this, &MainWindow::runPerformance);
     connect(btnAscii,       &QPushButton::clicked, this, &MainWindow::runAsciiMap);
+    connect(btnImprove,     &QPushButton::clicked, this, &MainWindow::runLocalSearch);
+    connect(btnStream,      &QPushButton::clicked, this, &MainWindow::runStreamSimulation);
 
     regenerateProducts();
 }
 
+// Pencere kapanırken süren kesin arama iptal edilir ve bitmesi beklenir:
+// app.exec() döndükten sonra arka planda iş parçacığı kalmaz
+MainWindow::~MainWindow() {
+    if (exactThread) {
+        exactCancel.store(true);
+        exactThread->wait();
+        delete exactThread;
+    }
+}
+
 void MainWindow::showStatus(const QString& msg) {
     statusBar()->showMessage(msg);
 }
 
+WorkloadSpec MainWindow::currentWorkload() const {
+    WorkloadSpec spec;
+    spec.seed = (uint64_t)spSeed->value();
+    spec.distribution = (WorkloadSpec::Distribution)distCombo->currentIndex();
+    return spec;
+}
+
 void MainWindow::regenerateProducts() {
-    lastProducts = WarehouseAlgorithms::generateProducts(spProductCount->value());
+    // Aynı tohum + dağılım her zaman aynı ürün setini verir
+    catalog = WarehouseAlgorithms::generateProducts(spProductCount->value(), currentWorkload());
+    catalogReplaced();
+
+    outText->setText("Yeni ürün seti üretildi.\nAlgoritma seçip çalıştırabilirsin.");
+    showStatus("Yeni ürün seti hazır.");
+}
+
+void MainWindow::catalogReplaced() {
+    catalogFingerprint = PlacementCache::fingerprint(catalog);
 
     // ÖNEMLİ: yeni ürün setinde önceki sonuçları "geçersiz" say
     hasStatic = false;
     hasGreedy = false;
     hasDP     = false;
 
-    lastShelves.clear();
+    nameIndex = NameIndex();
+    hasNameIndex = false;
 
-    outText->setText("Yeni ürün seti üretildi.\nAlgoritma seçip çalıştırabilirsin.");
-    showStatus("Yeni ürün seti hazır.");
+    locationIndex.clear();
+    hasLocationIndex = false;
+
+    // Eski yerleşim yeni katalogla gösterilemez
+    shelfModel->setSource(nullptr, nullptr);
+    lastLayout.clear();
 }
 
-void MainWindow::clearTableHighlights() {
-    for (int c = 0; c < table->columnCount(); ++c) {
-        for (int r = 0; r < table->rowCount(); ++r) {
-            if (auto* it = table->item(r, c)) {
-                it->setBackground(QBrush());
-                it->setForeground(QBrush());
-            }
+// .whcat doğrudan belleğe eşlenir; .csv önce kullanıcının seçtiği .whcat dosyasına dönüştürülür
+void MainWindow::openCatalog() {
+    const QString path = QFileDialog::getOpenFileName(this, "Katalog Aç", QString(),
+                                                      "Ürün Kataloğu (*.whcat *.csv)");
+    if (path.isEmpty()) return;
+
+    QString error;
+    QString binPath = path;
+    QString note;
+    if (path.endsWith(".csv", Qt::CaseInsensitive)) {
+        // Hedef sorulur: var olan dosyanın üzerine yazma onayı kayıt diyaloğunda alınır
+        binPath = QFileDialog::getSaveFileName(this, "İkili Katalog Kaydet",
+                                               path.left(path.size() - 4) + ".whcat",
+                                               "Ürün Kataloğu (*.whcat)");
+        if (binPath.isEmpty()) return;
+        if (QFileInfo(binPath) == QFileInfo(path)) {
+            QMessageBox::warning(this, "Hata", "İkili katalog CSV dosyasının üzerine yazılamaz.");
+            return;
         }
+        showStatus("CSV içe aktarılıyor...");
+
+        CsvImportStats st;
+        if (!CatalogFile::importCsv(path, binPath, CsvImportOptions(), &st, &error)) {
+            QMessageBox::warning(this, "Hata", "CSV içe aktarılamadı: " + error);
+            return;
+        }
+        note = QString("CSV içe aktarıldı: %1 satır (%2 atlandı), %3 MB, %4 ms, tampon %5 KB\n-> %6\n\n")
+                       .arg(st.rows)
+                       .arg(st.skipped)
+                       .arg(st.bytesRead / (1024.0 * 1024.0), 0, 'f', 1)
+                       .arg(st.elapsedMs)
+                       .arg(st.peakBufferBytes / 1024)
+                       .arg(binPath);
     }
-}
 
-void MainWindow::renderShelves(const std::vector<Shelf>& shelves) {
-    lastShelves = shelves;
+    Stopwatch sw;
+    ProductCatalog loaded;
+    CatalogFileInfo info;
+    if (!CatalogFile::open(binPath, loaded, &error, &info)) {
+        QMessageBox::warning(this, "Hata", "Katalog açılamadı: " + error);
+        return;
+    }
+    const double openMs = sw.elapsedUs() / 1000.0;
+
+    catalog = std::move(loaded);
+    catalogReplaced();
+
+    outText->setText(note + QString("Katalog açıldı (sürüm %1): %2 ürün, %3 MB, %4 ms\n"
+                                    "Sütunlar dosyaya eşlendi; ilk değişiklikte belleğe kopyalanır.")
+                                    .arg(info.version)
+                                    .arg(info.count)
+                                    .arg(info.fileBytes / (1024.0 * 1024.0), 0, 'f', 1)
+                                    .arg(openMs, 0, 'f', 2));
+    showStatus("Katalog açıldı.");
+}
 
-    table->clear();
-    table->setRowCount(0);
-    table->setColumnCount(0);
+void MainWindow::saveCatalog() {
+    const QString path = QFileDialog::getSaveFileName(this, "Katalog Kaydet", "urunler.whcat",
+                                                      "Ürün Kataloğu (*.whcat)");
+    if (path.isEmpty()) return;
 
-    table->setColumnCount((int)shelves.size());
-    QStringList headers;
-    for (int i = 0; i < (int)shelves.size(); ++i) {
-        headers << QString("Raf %1 (K:%2 U:%3)")
-                .arg(i+1)
-                .arg(shelves[i].capacity)
-                .arg(shelves[i].used);
-    }
-    table->setHorizontalHeaderLabels(headers);
-
-    int maxRow = 0;
-    for (const auto& s : shelves)
-        maxRow = std::max(maxRow, (int)s.products.size());
-    table->setRowCount(maxRow);
-
-    for (int c = 0; c < (int)shelves.size(); ++c) {
-        for (int r = 0; r < (int)shelves[c].products.size(); ++r) {
-            const auto& p = shelves[c].products[r];
-            table->setItem(r, c, new QTableWidgetItem(
-                    QString("%1\nS:%2 V:%3").arg(p.name).arg(p.sales).arg(p.volume)
-            ));
-        }
+    QString error;
+    if (!CatalogFile::write(catalog, path, &error)) {
+        QMessageBox::warning(this, "Hata", "Katalog yazılamadı: " + error);
+        return;
     }
+    showStatus(QString("Katalog kaydedildi: %1 ürün.").arg(catalog.size()));
+}
 
-    for (int c = 0; c < (int)shelves.size(); ++c) {
-        double ratio = (shelves[c].capacity == 0)
-                       ? 0.0
-                       : (double)shelves[c].used / shelves[c].capacity;
+void MainWindow::clearTableHighlights() {
+    shelfModel->clearHighlight();
+}
 
-        QColor cellBg;
-        QColor headerBg;
+void MainWindow::renderShelves(const ShelfLayout& layout, bool indexCurrent) {
+    lastLayout = layout;
+    if (hasLocationIndex && !indexCurrent) locationIndex.assignPlacement(layout);
 
-        if (ratio < 0.5) {
-            cellBg   = QColor(200, 255, 200);
-            headerBg = QColor(150, 220, 150);
-        }
-        else if (ratio < 0.8) {
-            cellBg   = QColor(255, 240, 180);
-            headerBg = QColor(230, 210, 140);
-        }
-        else {
-            cellBg   = QColor(255, 200, 200);
-            headerBg = QColor(230, 160, 160);
-        }
+    // Model yalnızca yerleşimi gösterir; hücre metni ve renkleri data()'da
+    shelfModel->setSource(&lastLayout, &catalog);
+}
 
-        for (int r = 0; r < table->rowCount(); ++r) {
-            if (auto* it = table->item(r, c)) {
-                it->setBackground(cellBg);
-            }
-        }
+// -------------------- önbellek
+PlacementCacheKey MainWindow::cacheKey(PlacementAlgo algo, uint64_t param) const {
+    PlacementCacheKey key;
+    key.catalog = catalogFingerprint;
+    key.catalogSize = catalog.size();
+    key.algo = algo;
+    key.shelfCount = spShelfCount->value();
+    key.shelfCap = spShelfCap->value();
+    key.param = param;
+    return key;
+}
 
-        if (auto* headerItem = table->horizontalHeaderItem(c)) {
-            headerItem->setBackground(headerBg);
-            headerItem->setForeground(Qt::black);
-        }
-    }
+PlacementResult MainWindow::staticResult(bool* cached) {
+    return placementCache.getOrCompute<PlacementResult>(cacheKey(PlacementAlgo::Static), [&] {
+        return WarehouseAlgorithms::staticPlacement(catalog, spShelfCount->value(), spShelfCap->value());
+    }, cached);
+}
 
-    clearTableHighlights();
+PlacementResult MainWindow::greedyResult(bool* cached) {
+    return placementCache.getOrCompute<PlacementResult>(cacheKey(PlacementAlgo::Greedy), [&] {
+        return WarehouseAlgorithms::greedyPlacement(catalog, spShelfCount->value(), spShelfCap->value());
+    }, cached);
+}
+
+DPKnapsackResult MainWindow::dpResult(bool* cached) {
+    return placementCache.getOrCompute<DPKnapsackResult>(cacheKey(PlacementAlgo::DP), [&] {
+        return WarehouseAlgorithms::dpPlacementKnapsack(catalog, spShelfCount->value(), spShelfCap->value());
+    }, cached);
+}
+
+void MainWindow::appendCacheNote(bool cached) {
+    if (!cached) return;
+    const PlacementCacheStats& st = placementCache.stats();
+    outText->append(QString("\nÖnbellekten geldi, yeniden hesaplanmadı (süreler ilk çalıştırmanın).\n"
+                            "Önbellek: %1 sonuç, %2 KB, isabet %3 / ıska %4")
+                            .arg(st.entries)
+                            .arg(st.bytes / 1024)
+                            .arg(st.hits)
+                            .arg(st.misses));
+}
+
+// Konum indeksi ilk ihtiyaçta kurulur: O(n) isim katlama açılışta değil aramada
+void MainWindow::ensureLocationIndex() {
+    if (hasLocationIndex) return;
+    locationIndex.buildCatalog(catalog);
+    if (!lastLayout.empty()) locationIndex.assignPlacement(lastLayout);
+    hasLocationIndex = true;
 }
 
 void MainWindow::highlightProductInTable(const QString& name) {
     clearTableHighlights();
 
-    bool found = false;
-    for (int c = 0; c < table->columnCount(); ++c) {
-        for (int r = 0; r < table->rowCount(); ++r) {
-            if (auto* it = table->item(r, c)) {
-                QString firstLine = it->text().split('\n').value(0).trimmed();
-                if (firstLine.compare(name, Qt::CaseInsensitive) == 0) {
-                    it->setBackground(QColor(255, 235, 59));
-                    it->setForeground(Qt::black);
-                    table->scrollToItem(it);
-                    found = true;
-                }
-            }
-        }
+    // Konum indeksi ürünün hücresini doğrudan verir
+    ensureLocationIndex();
+    const ProductLocation loc = locationIndex.find(name);
+    if (loc.shelf < 0) {
+        outText->append("\nUyarı: Bu isimle birebir eşleşen ürün yok.");
+        return;
     }
 
-    if (!found) outText->append("\nUyarı: Bu isimle birebir eşleşen ürün yok.");
+    shelfModel->setHighlight(loc.slot, loc.shelf);
+    table->scrollTo(shelfModel->index(loc.slot, loc.shelf));
 }
 
 void MainWindow::runSearch() {
@@ -298,102 +496,291 @@ void MainWindow::runSearch() {
     outText->append("Aranan: " + key);
 
     if (searchTypeCombo->currentIndex() == 0) {
-        auto r = WarehouseAlgorithms::linearSearchByName(lastProducts, key);
+        auto r = WarehouseAlgorithms::linearSearchByName(catalog, key);
         outText->append(QString("Linear Search → found=%1 | %2 µs | O(n)")
                                 .arg(r.found ? "true":"false")
                                 .arg(r.elapsedUs));
+    } else if (searchTypeCombo->currentIndex() == 2) {
+        if (!hasLocationIndex) {
+            ensureLocationIndex();
+            outText->append("Hash Index için konum indeksi kuruldu: O(n)");
+        }
+        auto r = WarehouseAlgorithms::hashSearchByName(locationIndex, key);
+        outText->append(QString("Hash Index → found=%1 | %2 µs | O(1)")
+                                .arg(r.found ? "true":"false")
+                                .arg(r.elapsedUs));
     } else {
-        auto sorted = lastProducts;
-        WarehouseAlgorithms::sortByNameAsc(sorted);
-        auto r = WarehouseAlgorithms::binarySearchByName(sorted, key);
-        outText->append("Binary Search için sıralama yapıldı: O(n log n)");
+        // Sıralı görünüm ürün seti değişene kadar önbellekte kalır
+        if (!hasNameIndex) {
+            nameIndex = WarehouseAlgorithms::buildNameIndex(catalog);
+            hasNameIndex = true;
+            outText->append("Binary Search için sıralama yapıldı: O(n log n)");
+        } else {
+            outText->append("Binary Search için sıralı görünüm önbellekten kullanıldı.");
+        }
+        auto r = WarehouseAlgorithms::binarySearchByName(nameIndex, key);
         outText->append(QString("Binary Search → found=%1 | %2 µs | O(log n)")
                                 .arg(r.found ? "true":"false")
                                 .arg(r.elapsedUs));
     }
 
-    if (table->rowCount() > 0) highlightProductInTable(key);
+    if (shelfModel->rowCount() > 0) highlightProductInTable(key);
     else outText->append("\nNot: Sarı işaretleme için önce Statik/Greedy/DP çalıştır.");
 
     showStatus("Arama tamamlandı.");
 }
 
 void MainWindow::runStatic() {
-    lastStaticResult =
-            WarehouseAlgorithms::staticPlacement(
-                    lastProducts,
-                    spShelfCount->value(),
-                    spShelfCap->value()
-            );
+    bool cached = false;
+    lastStaticResult = staticResult(&cached);
 
     hasStatic = true;
-    renderShelves(lastStaticResult.shelves);
+    renderShelves(lastStaticResult.layout);
 
     outText->setText(
             QString("Statik Yerleşim\nSüre: %1 ms\nO(n)")
                     .arg(lastStaticResult.elapsedMs)
     );
+    outText->append(profileText(lastStaticResult.profile));
+    appendCacheNote(cached);
 
     showStatus("Statik Yerleşim tamamlandı.");
 }
 
 void MainWindow::runGreedy() {
-    lastGreedyResult =
-            WarehouseAlgorithms::greedyPlacement(
-                    lastProducts,
-                    spShelfCount->value(),
-                    spShelfCap->value()
-            );
+    bool cached = false;
+    lastGreedyResult = greedyResult(&cached);
 
     hasGreedy = true;
-    renderShelves(lastGreedyResult.shelves);
+    renderShelves(lastGreedyResult.layout);
 
     outText->setText(
-            QString("Greedy Yerleşim\nSüre: %1 ms\nO(n log n)")
+            QString("Greedy Yerleşim\nSüre: %1 ms\nO(n log n + n log m)")
                     .arg(lastGreedyResult.elapsedMs)
     );
+    outText->append(profileText(lastGreedyResult.profile));
+    appendCacheNote(cached);
 
     showStatus("Greedy Yerleşim tamamlandı.");
 }
+void MainWindow::runBestFit() {
+    bool cached = false;
+    auto r = placementCache.getOrCompute<PlacementResult>(cacheKey(PlacementAlgo::BestFit), [&] {
+        return WarehouseAlgorithms::bestFitDecreasingPlacement(catalog, spShelfCount->value(), spShelfCap->value());
+    }, &cached);
+
+    renderShelves(r.layout);
+
+    outText->setText(
+            QString("Best-Fit Decreasing (Satış/Hacim)\nSüre: %1 ms\nO(n log n + n log m)")
+                    .arg(r.elapsedMs)
+    );
+    outText->append(profileText(r.profile));
+    appendCacheNote(cached);
+
+    showStatus("Best-Fit Yerleşim tamamlandı.");
+}
+
 void MainWindow::runDP() {
-    lastDPResult =
-            WarehouseAlgorithms::dpPlacementKnapsack(
-                    lastProducts,
-                    spShelfCount->value(),
-                    spShelfCap->value()
-            );
+    if (!dpTableFits(this, catalog.size(), spShelfCap->value())) return;
+
+    bool cached = false;
+    lastDPResult = dpResult(&cached);
 
     hasDP = true;
-    renderShelves(lastDPResult.placement.shelves);
+    renderShelves(lastDPResult.placement.layout);
 
     outText->setText(
             QString("DP (Knapsack)\nSüre: %1 ms\nO(n*C)")
                     .arg(lastDPResult.placement.elapsedMs)
     );
+    outText->append(profileText(lastDPResult.placement.profile));
+    appendCacheNote(cached);
 
     showStatus("DP Yerleşim tamamlandı.");
 }
 
-void MainWindow::runDepotEfficiency() {
-    if (!hasStatic || !hasGreedy || !hasDP) {
-        QMessageBox::warning(this, "Uyarı",
-                             "Lütfen önce Statik, Greedy ve DP algoritmalarını çalıştırın.");
+void MainWindow::runDPVolumeClasses() {
+    if (!volumeClassTableFits(this, catalog, spShelfCap->value())) return;
+
+    bool cached = false;
+    auto r = placementCache.getOrCompute<DPKnapsackResult>(cacheKey(PlacementAlgo::DPVolumeClasses), [&] {
+        return WarehouseAlgorithms::dpPlacementVolumeClasses(catalog, spShelfCount->value(), spShelfCap->value());
+    }, &cached);
+
+    renderShelves(r.placement.layout);
+
+    outText->setText(
+            QString("DP (Hacim Sınıfı)\nSüre: %1 ms\nO(sınıf * C log C)")
+                    .arg(r.placement.elapsedMs)
+    );
+    outText->append(profileText(r.placement.profile));
+    appendCacheNote(cached);
+
+    showStatus("DP (Hacim Sınıfı) Yerleşim tamamlandı.");
+}
+
+void MainWindow::runDPParallel() {
+    if (!dpTableFits(this, catalog.size(), spShelfCap->value())) return;
+
+    bool cached = false;
+    auto r = placementCache.getOrCompute<PlacementResult>(cacheKey(PlacementAlgo::DPParallel), [&] {
+        return WarehouseAlgorithms::dpPlacementParallel(catalog, spShelfCount->value(), spShelfCap->value());
+    }, &cached);
+
+    renderShelves(r.layout);
+
+    auto placedSales = [this](const ShelfLayout& layout) {
+        long long sum = 0;
+        for (int i : layout.items) sum += catalog.sales(i);
+        return sum;
+    };
+
+    outText->setText(
+            QString("DP (Paralel Raf)\nSüre: %1 ms\nToplam satış: %2\nO(m * havuz * C / iş parçacığı)")
+                    .arg(r.elapsedMs)
+                    .arg(placedSales(r.layout))
+    );
+    // Sıralı DP aynı ayarlarla çalıştırıldıysa kalite karşılaştırması
+    if (hasDP && lastDPResult.placement.layout.shelfCount() == spShelfCount->value()) {
+        const long long seq = placedSales(lastDPResult.placement.layout);
+        if (seq > 0)
+            outText->append(QString("Sıralı DP'ye göre: %%1 (sıralı %2 ms)")
+                                    .arg(placedSales(r.layout) * 100.0 / seq, 0, 'f', 2)
+                                    .arg(lastDPResult.placement.elapsedMs));
+    }
+    outText->append(profileText(r.profile));
+    appendCacheNote(cached);
+
+    showStatus("DP (Paralel Raf) Yerleşim tamamlandı.");
+}
+
+void MainWindow::runApprox() {
+    ApproxKnapsackOptions opt;
+    opt.epsilon = spEpsilon->value();
+
+    uint64_t epsBits = 0;
+    std::memcpy(&epsBits, &opt.epsilon, sizeof(epsBits));
+
+    bool cached = false;
+    auto r = placementCache.getOrCompute<ApproxPlacementResult>(cacheKey(PlacementAlgo::Approx, epsBits), [&] {
+        return WarehouseAlgorithms::approxPlacementKnapsack(catalog, spShelfCount->value(), spShelfCap->value(), opt);
+    }, &cached);
+
+    renderShelves(r.placement.layout);
+
+    outText->setText(
+            QString("Yaklaşık DP (FPTAS)\nSüre: %1 ms\nε: %2 (uygulanan %3)\n"
+                    "Garanti: her raf >= %4 x kesin DP\n"
+                    "Kesin (GCD) raf: %5, ölçekli raf: %6, tablo: %7 KB")
+                    .arg(r.placement.elapsedMs)
+                    .arg(r.epsilon, 0, 'f', 3)
+                    .arg(r.effectiveEpsilon, 0, 'f', 3)
+                    .arg(r.guaranteedRatio, 0, 'f', 3)
+                    .arg(r.exactShelves)
+                    .arg(r.scaledShelves)
+                    .arg(r.peakTableBytes / 1024)
+    );
+    outText->append(profileText(r.placement.profile));
+    appendCacheNote(cached);
+
+    showStatus("Yaklaşık DP Yerleşim tamamlandı.");
+}
+
+void MainWindow::runExact() {
+    if (exactThread) {
+        showStatus("Kesin yerleşim zaten aranıyor...");
         return;
     }
+    if (!volumeClassTableFits(this, catalog, spShelfCap->value())) return;
+
+    // Süre sınırı aşılırsa en iyi bulunan gösterilir
+    BranchAndBoundOptions opt;
+    opt.timeLimitMs = 2000;
+    opt.cancel = &exactCancel;
+
+    const PlacementCacheKey key = cacheKey(PlacementAlgo::Exact, (uint64_t)opt.timeLimitMs);
+    ExactPlacementResult hit;
+    if (placementCache.lookup(key, hit)) {
+        showExactResult(hit, true);
+        return;
+    }
+
+    // Arama GUI dışındaki iş parçacığında, katalog kopyası üzerinde
+    auto result = std::make_shared<ExactPlacementResult>();
+    const int shelfCount = spShelfCount->value();
+    const int shelfCap = spShelfCap->value();
+    QThread* thread = QThread::create([result, snapshot = catalog, shelfCount, shelfCap, opt] {
+        *result = WarehouseAlgorithms::exactPlacementBranchAndBound(snapshot, shelfCount, shelfCap, opt);
+    });
+    exactThread = thread;
+    exactCancel.store(false);
+    btnRun->setEnabled(false);
+
+    connect(thread, &QThread::finished, this, [this, thread, result, key] {
+        thread->deleteLater();
+        btnRun->setEnabled(true);
+        // Süre sınırında kesilen sonuç kesin değildir, önbelleğe alınmaz
+        if (result->provenOptimal) placementCache.store(key, *result);
+
+        // Arama sürerken katalog ya da raf ayarları değiştiyse sonuç gösterilmez
+        if (!(cacheKey(PlacementAlgo::Exact, key.param) == key)) {
+            showStatus("Kesin yerleşim bitti; ayarlar değiştiği için gösterilmedi.");
+            return;
+        }
+        showExactResult(*result, false);
+    });
+
+    showStatus("Kesin yerleşim aranıyor...");
+    thread->start();
+}
+
+void MainWindow::showExactResult(const ExactPlacementResult& r, bool cached) {
+    renderShelves(r.placement.layout);
+
+    const double gap = r.upperBound > 0
+            ? (double)(r.upperBound - r.placedSales) * 100.0 / r.upperBound : 0.0;
+    outText->setText(
+            QString("Kesin (Branch&Bound)\nSüre: %1 ms\nToplam satış: %2\n"
+                    "Üst sınır: %3 (fark %%4)\nDüğüm: %5, iş parçacığı: %6\n%7")
+                    .arg(r.placement.elapsedMs)
+                    .arg(r.placedSales)
+                    .arg(r.upperBound)
+                    .arg(gap, 0, 'f', 2)
+                    .arg(r.nodes)
+                    .arg(r.threads)
+                    .arg(r.provenOptimal ? "Optimal (kanıtlandı)" : "Limit aşıldı: en iyi bulunan")
+    );
+    outText->append(profileText(r.placement.profile));
+    appendCacheNote(cached);
+
+    showStatus("Kesin yerleşim tamamlandı.");
+}
+
+void MainWindow::runDepotEfficiency() {
+    // Güncel ayarlarla üç sonuç önbellekten; çalıştırılmamış olanlar burada hesaplanır
+    if (!dpTableFits(this, catalog.size(), spShelfCap->value())) return;
+
+    bool cachedStatic = false, cachedGreedy = false, cachedDP = false;
+    lastStaticResult = staticResult(&cachedStatic);
+    lastGreedyResult = greedyResult(&cachedGreedy);
+    lastDPResult     = dpResult(&cachedDP);
+    hasStatic = hasGreedy = hasDP = true;
+    const int computed = !cachedStatic + !cachedGreedy + !cachedDP;
 
     int totalCapacity = spShelfCount->value() * spShelfCap->value();
     if (totalCapacity <= 0) totalCapacity = 1;
 
-    auto calcUsed = [](const std::vector<Shelf>& shelves) {
+    auto calcUsed = [](const ShelfLayout& layout) {
         int used = 0;
-        for (const auto& s : shelves)
-            used += s.used;
+        for (int u : layout.used)
+            used += u;
         return used;
     };
 
-    double effStatic = (double)calcUsed(lastStaticResult.shelves) / totalCapacity * 100.0;
-    double effGreedy = (double)calcUsed(lastGreedyResult.shelves) / totalCapacity * 100.0;
-    double effDP     = (double)calcUsed(lastDPResult.placement.shelves) / totalCapacity * 100.0;
+    double effStatic = (double)calcUsed(lastStaticResult.layout) / totalCapacity * 100.0;
+    double effGreedy = (double)calcUsed(lastGreedyResult.layout) / totalCapacity * 100.0;
+    double effDP     = (double)calcUsed(lastDPResult.placement.layout) / totalCapacity * 100.0;
 
     auto* set = new QBarSet("Depo Doluluk (%)");
     *set << effStatic << effGreedy << effDP;
@@ -447,16 +834,204 @@ void MainWindow::runDepotEfficiency() {
                     .arg(effGreedy, 0, 'f', 2)
                     .arg(effDP,     0, 'f', 2)
     );
+    if (computed > 0)
+        outText->append(QString("\n%1 algoritma bu karşılaştırma için hesaplandı, diğerleri önbellekten.").arg(computed));
     showStatus("Depo verimliliği grafiği oluşturuldu.");
 }
 
+void MainWindow::runLocalSearch() {
+    if (lastLayout.empty()) {
+        outText->setText("Önce yerleşim çalıştır.");
+        return;
+    }
+
+    PlacementResult start;
+    start.layout = lastLayout;
+
+    LocalSearchOptions opt;
+    opt.timeBudgetMs = spImproveBudget->value();
+    opt.seed = (uint64_t)spSeed->value();
+
+    LocalSearchStats st;
+    auto r = WarehouseAlgorithms::improvePlacement(start, catalog, opt, &st);
+
+    const double effBefore = WarehouseAlgorithms::computeWarehouseEfficiency(lastLayout);
+    const double effAfter  = WarehouseAlgorithms::computeWarehouseEfficiency(r.layout);
+    renderShelves(r.layout);
+
+    outText->setText(
+            QString("Yerel Arama (bütçe %1 ms, süre %2 ms)\n"
+                    "Toplam satış: %3 -> %4\nDoluluk: %%5 -> %%6\n"
+                    "Ekleme: %7, takas: %8, 1->2: %9, 2->1: %10, taşıma: %11\n"
+                    "Pertürbasyon: %12, değerlendirilen komşu: %13%14")
+                    .arg(opt.timeBudgetMs)
+                    .arg(r.elapsedMs)
+                    .arg(st.startSales)
+                    .arg(st.finalSales)
+                    .arg(effBefore, 0, 'f', 2)
+                    .arg(effAfter, 0, 'f', 2)
+                    .arg(st.inserts)
+                    .arg(st.swaps)
+                    .arg(st.oneForTwo)
+                    .arg(st.twoForOne)
+                    .arg(st.relocations)
+                    .arg(st.perturbations)
+                    .arg(st.evaluations)
+                    .arg(st.budgetExhausted ? "" : "\n(bütçe bitmeden durgunlukla durdu)")
+    );
+
+    showStatus("Yerel arama tamamlandı.");
+}
+
+// Sürekli ürün akışı: ekleme / çıkarma / satış güncellemesi yerel yamalarla
+void MainWindow::runStreamSimulation() {
+    const int shelfCount = spShelfCount->value();
+    const int shelfCap = spShelfCap->value();
+
+    // Son yerleşim aynı raf düzenindeyse oradan devam edilir
+    const bool reuse = !lastLayout.empty() && lastLayout.shelfCount() == shelfCount
+                       && lastLayout.capacity.front() == shelfCap;
+    PlacementEngine engine(catalog, shelfCount, shelfCap, reuse ? lastLayout : ShelfLayout());
+    const double effStart = engine.efficiency();
+
+    // Konum indeksi kuruluysa akış boyunca her işlemle artımlı güncellenir
+    const bool trackIndex = hasLocationIndex;
+    if (trackIndex) engine.attachIndex(&locationIndex);
+
+    // İşlem sayısı = ürün sayısı; %40 ekleme, %30 çıkarma, %30 satış güncellemesi
+    std::mt19937_64 rng((uint64_t)spSeed->value());
+    const int ops = std::max(1, spProductCount->value());
+    Stopwatch sw;
+    for (int k = 0; k < ops; ++k) {
+        const int r = (int)(rng() % 10);
+        const int n = engine.catalog().size();
+        if (r < 4 || n == 0) {
+            engine.insert(QString("Yeni_%1").arg(n + 1), 50 + (int)(rng() % 250), 1 + (int)(rng() % 8));
+        } else if (r < 7) {
+            engine.remove((int)(rng() % n));
+        } else {
+            engine.updateSales((int)(rng() % n), 50 + (int)(rng() % 250));
+        }
+    }
+    const double usPerOp = (double)sw.elapsedUs() / ops;
+
+    // Akış sonrası canlı ürünler geçerli katalog olur; önceki sonuçlar geçersiz
+    // İndeks yeniden kurulmaz, yalnızca sıkıştırılmış indekslere taşınır
+    ShelfLayout streamed;
+    std::vector<int> remap;
+    ProductCatalog live = engine.liveCatalog(&streamed, &remap);
+    engine.attachIndex(nullptr);
+
+    ProductLocationIndex tracked;
+    if (trackIndex) {
+        tracked = std::move(locationIndex);
+        tracked.remap(remap);
+    }
+    catalog = std::move(live);
+    catalogReplaced();
+    if (trackIndex) {
+        locationIndex = std::move(tracked);
+        hasLocationIndex = true;
+    }
+    renderShelves(streamed, trackIndex);
+
+    const PlacementEngineStats& st = engine.stats();
+    outText->setText(
+            QString("Ürün Akışı (%1 işlem, %2 µs/işlem)\n"
+                    "Ekleme: %3 (doğrudan rafa: %4), çıkarma: %5, satış güncellemesi: %6\n"
+                    "Boşluk doldurma: %7, takas: %8\n"
+                    "Yeniden optimizasyon: %9 (%10 ms)\n"
+                    "Canlı ürün: %11, rafta: %12, toplam satış: %13\n"
+                    "Doluluk: %%14 -> %%15")
+                    .arg(ops)
+                    .arg(usPerOp, 0, 'f', 2)
+                    .arg(st.inserts)
+                    .arg(st.placedOnArrival)
+                    .arg(st.removals)
+                    .arg(st.salesUpdates)
+                    .arg(st.gapFills)
+                    .arg(st.swaps)
+                    .arg(st.reoptimizations)
+                    .arg(st.reoptimizeUs / 1000.0, 0, 'f', 1)
+                    .arg(engine.liveCount())
+                    .arg(engine.placedCount())
+                    .arg(engine.placedSales())
+                    .arg(effStart, 0, 'f', 2)
+                    .arg(engine.efficiency(), 0, 'f', 2)
+    );
+    showStatus("Ürün akışı tamamlandı.");
+}
+
 void MainWindow::runAsciiMap() {
-    if (lastShelves.empty()) {
+    if (lastLayout.empty()) {
         outText->setText("Önce yerleşim çalıştır.");
         return;
     }
-    outText->setText(WarehouseAlgorithms::buildAsciiMap(lastShelves));
-    showStatus("ASCII depo üretildi.");
+
+    // Harita sayfa sayfa üretilir; tamamı yalnızca dosyaya akıtılır
+    constexpr int kLinesPerPage = 2000;
+    auto writer = std::make_shared<AsciiMapWriter>(lastLayout, catalog);
+    const std::vector<int> pages = writer->paginate(kLinesPerPage);
+    const int pageCount = (int)pages.size() - 1;
+    const qsizetype totalChars = writer->sizeHint(0, lastLayout.shelfCount());
+
+    auto* dlg = new QDialog(this);
+    dlg->setWindowTitle("ASCII Depo Haritası");
+    dlg->resize(900, 700);
+
+    auto* root = new QVBoxLayout(dlg);
+
+    auto* view = new QPlainTextEdit();
+    view->setReadOnly(true);
+    view->setLineWrapMode(QPlainTextEdit::NoWrap);
+    view->setStyleSheet("font-family: Consolas; font-size: 13px;");
+    root->addWidget(view, 1);
+
+    auto* nav = new QHBoxLayout();
+    auto* btnPrev = new QPushButton("◀ Önceki");
+    auto* btnNext = new QPushButton("Sonraki ▶");
+    auto* spPage  = new QSpinBox();
+    spPage->setRange(1, pageCount);
+    spPage->setSuffix(QString(" / %1").arg(pageCount));
+    auto* info = new QLabel(QString("%1 raf, %2 KB").arg(lastLayout.shelfCount()).arg(totalChars / 1024));
+    auto* btnSave  = new QPushButton("Dosyaya Kaydet...");
+    auto* btnClose = new QPushButton("Close");
+
+    nav->addWidget(btnPrev);
+    nav->addWidget(spPage);
+    nav->addWidget(btnNext);
+    nav->addWidget(info, 1);
+    nav->addWidget(btnSave);
+    nav->addWidget(btnClose);
+    root->addLayout(nav);
+
+    auto showPage = [=](int oneBased) {
+        view->setPlainText(writer->page(pages, oneBased - 1));
+        btnPrev->setEnabled(oneBased > 1);
+        btnNext->setEnabled(oneBased < pageCount);
+    };
+    connect(spPage, &QSpinBox::valueChanged, dlg, showPage);
+    connect(btnPrev, &QPushButton::clicked, dlg, [spPage] { spPage->setValue(spPage->value() - 1); });
+    connect(btnNext, &QPushButton::clicked, dlg, [spPage] { spPage->setValue(spPage->value() + 1); });
+
+    connect(btnSave, &QPushButton::clicked, dlg, [=] {
+        const QString path = QFileDialog::getSaveFileName(dlg, "ASCII Haritayı Kaydet",
+                                                          "depo_haritasi.txt", "Metin (*.txt)");
+        if (path.isEmpty()) return;
+
+        FileMapSink sink(path);
+        if (!sink.isOpen() || !writer->writeAll(sink)) {
+            QMessageBox::warning(dlg, "Hata", "Dosya yazılamadı: " + sink.errorString());
+            return;
+        }
+        showStatus("ASCII depo dosyaya yazıldı: " + path);
+    });
+    connect(btnClose, &QPushButton::clicked, dlg, &QDialog::accept);
+
+    showPage(1);
+    showStatus(QString("ASCII depo üretildi (%1 sayfa).").arg(pageCount));
+    dlg->exec();
+    delete dlg;
 }
 
 
@@ -470,100 +1045,252 @@ void MainWindow::runPerformance()
         QMessageBox::warning(this, "Uyarı", "Ürün / Raf / Kapasite değerleri 0'dan büyük olmalıdır.");
         return;
     }
+    if (!dpTableFits(this, maxN, shelfCap)) return;
 
     auto* dlg = new QDialog(this);
     dlg->setWindowTitle("Performans Karşılaştırması (Süre - Ürün Sayısı)");
-    dlg->resize(1200, 520);
+    dlg->resize(1200, 560);
 
     auto* root = new QVBoxLayout(dlg);
-    auto* row  = new QHBoxLayout();
+
+    // Kontroller
+    auto* ctrl = new QHBoxLayout();
+    auto* chkGeometric = new QCheckBox("Geometrik örnekleme");
+    chkGeometric->setChecked(maxN > 500);
+    auto* spSamples = new QSpinBox();
+    spSamples->setRange(10, 1000);
+    spSamples->setValue(60);
+    spSamples->setPrefix("Örnek: ");
+    spSamples->setEnabled(chkGeometric->isChecked());
+    connect(chkGeometric, &QCheckBox::toggled, spSamples, &QSpinBox::setEnabled);
+
+    auto* btnStart  = new QPushButton("Başlat");
+    auto* btnCancel = new QPushButton("İptal");
+    btnCancel->setEnabled(false);
+    auto* bar = new QProgressBar();
+    bar->setRange(0, 1);
+    bar->setValue(0);
+
+    ctrl->addWidget(chkGeometric);
+    ctrl->addWidget(spSamples);
+    ctrl->addWidget(btnStart);
+    ctrl->addWidget(btnCancel);
+    ctrl->addWidget(bar, 1);
+    root->addLayout(ctrl);
+
+    auto* row = new QHBoxLayout();
     root->addLayout(row, 1);
 
+    // Ayırma kancaları bağlıysa süre yanında tepe bellek de çizilir (sağ eksen)
+    const bool trackMemory = AllocationTracker::installed();
+
     auto makeChart = [&](const QString& title) {
         auto* chart = new QChart();
         chart->setTitle(title + QString("\n(Raf=%1, Kapasite=%2, MaxN=%3)")
                                 .arg(shelfCount).arg(shelfCap).arg(maxN));
-        chart->legend()->setVisible(false);
+        chart->legend()->setVisible(trackMemory);
+        chart->legend()->setAlignment(Qt::AlignBottom);
         chart->setAnimationOptions(QChart::NoAnimation);
         return chart;
     };
 
-    auto* chartS = makeChart("Statik Yerleşim");
-    auto* chartG = makeChart("Greedy Yerleşim");
-    auto* chartD = makeChart("DP (Knapsack) Yerleşim");
+    // Grafik durumu: lambdalar dialog kapandıktan sonra da güvenle erişebilsin diye heap'te
+    struct PerfChart {
+        QChart*        chart = nullptr;
+        QLineSeries*   series = nullptr;
+        QValueAxis*    axisY = nullptr;
+        QList<QPointF> pending;
 
-    auto* sS = new QLineSeries();
-    auto* sG = new QLineSeries();
-    auto* sD = new QLineSeries();
-
-    chartS->addSeries(sS);
-    chartG->addSeries(sG);
-    chartD->addSeries(sD);
-
-    auto* vS = new QChartView(chartS);
-    auto* vG = new QChartView(chartG);
-    auto* vD = new QChartView(chartD);
-
-    vS->setRenderHint(QPainter::Antialiasing);
-    vG->setRenderHint(QPainter::Antialiasing);
-    vD->setRenderHint(QPainter::Antialiasing);
-
-    row->addWidget(vS, 1);
-    row->addWidget(vG, 1);
-    row->addWidget(vD, 1);
-
-    // Benchmark: 1..maxN
-    double maxY = 1.0;
-
-    for (int n = 1; n <= maxN; ++n) {
-        auto products = WarehouseAlgorithms::generateProducts(n);
-
-        auto rS = WarehouseAlgorithms::staticPlacement(products, shelfCount, shelfCap);
-        auto rG = WarehouseAlgorithms::greedyPlacement(products, shelfCount, shelfCap);
-        auto rD = WarehouseAlgorithms::dpPlacementKnapsack(products, shelfCount, shelfCap);
-
-        const double tS = (double)rS.elapsedUs;
-        const double tG = (double)rG.elapsedUs;
-        const double tD = (double)rD.placement.elapsedUs;
-
-        sS->append(n, tS);
-        sG->append(n, tG);
-        sD->append(n, tD);
+        QLineSeries*   memSeries = nullptr;
+        QValueAxis*    axisMem = nullptr;
+        QList<QPointF> pendingMem;
+    };
+    struct PerfState {
+        PerfChart charts[3];
+        double maxY = 1.0;
+        double maxMem = 1.0;
+        QPointer<QThread> thread;
+        QPointer<PerformanceWorker> worker;
+    };
+    auto state = std::make_shared<PerfState>();
+
+    const QString titles[3] = { "Statik Yerleşim", "Greedy Yerleşim", "DP (Knapsack) Yerleşim" };
+    for (int k = 0; k < 3; ++k) {
+        PerfChart& pc = state->charts[k];
+        pc.chart  = makeChart(titles[k]);
+        pc.series = new QLineSeries();
+        pc.series->setName("Süre (µs)");
+        pc.chart->addSeries(pc.series);
+
+        if (trackMemory) {
+            pc.memSeries = new QLineSeries();
+            pc.memSeries->setName("Tepe bellek (KB)");
+            pc.chart->addSeries(pc.memSeries);
+        }
 
-        maxY = std::max({maxY, tS, tG, tD});
+        auto* view = new QChartView(pc.chart);
+        view->setRenderHint(QPainter::Antialiasing);
+        row->addWidget(view, 1);
     }
 
-    auto applyAxes = [&](QChart* c) {
-        // temiz başlat
-        for (auto* ax : c->axes(Qt::Horizontal)) c->removeAxis(ax);
-        for (auto* ay : c->axes(Qt::Vertical))   c->removeAxis(ay);
+    auto applyAxes = [state, maxN](bool logX) {
+        for (PerfChart& pc : state->charts) {
+            QChart* c = pc.chart;
+            // temiz başlat
+            for (auto* ax : c->axes(Qt::Horizontal)) { c->removeAxis(ax); delete ax; }
+            for (auto* ay : c->axes(Qt::Vertical))   { c->removeAxis(ay); delete ay; }
+
+            QAbstractAxis* axX = nullptr;
+            if (logX) {
+                auto* lx = new QLogValueAxis();
+                lx->setBase(10.0);
+                lx->setLabelFormat("%d");
+                lx->setRange(1, std::max(2, maxN));
+                axX = lx;
+            } else {
+                auto* vx = new QValueAxis();
+                vx->setLabelFormat("%d");
+                vx->setRange(1, maxN);
+                axX = vx;
+            }
+            axX->setTitleText("Ürün Sayısı (N)");
+
+            auto* axY = new QValueAxis();
+            axY->setTitleText("Süre (µs)");
+            axY->setRange(0, state->maxY * 1.15);
+            pc.axisY = axY;
+
+            c->addAxis(axX, Qt::AlignBottom);
+            c->addAxis(axY, Qt::AlignLeft);
+            pc.series->attachAxis(axX);
+            pc.series->attachAxis(axY);
+
+            if (pc.memSeries) {
+                auto* axM = new QValueAxis();
+                axM->setTitleText("Tepe bellek (KB)");
+                axM->setRange(0, state->maxMem * 1.15);
+                pc.axisMem = axM;
+
+                c->addAxis(axM, Qt::AlignRight);
+                pc.memSeries->attachAxis(axX);
+                pc.memSeries->attachAxis(axM);
+            }
+        }
+    };
 
-        auto* axX = new QValueAxis();
-        axX->setTitleText("Ürün Sayısı (N)");
-        axX->setLabelFormat("%d");
-        axX->setRange(1, maxN);
+    // Noktalar tamponda birikir, grafiğe ~100 ms'de bir toplu eklenir
+    auto* flushTimer = new QTimer(dlg);
+    flushTimer->setInterval(100);
+    auto flush = [state]() {
+        for (PerfChart& pc : state->charts) {
+            if (!pc.pending.isEmpty()) {
+                pc.series->append(pc.pending);
+                pc.pending.clear();
+                pc.axisY->setRange(0, state->maxY * 1.15);
+            }
+            if (pc.memSeries && !pc.pendingMem.isEmpty()) {
+                pc.memSeries->append(pc.pendingMem);
+                pc.pendingMem.clear();
+                pc.axisMem->setRange(0, state->maxMem * 1.15);
+            }
+        }
+    };
+    connect(flushTimer, &QTimer::timeout, dlg, flush);
 
-        auto* axY = new QValueAxis();
-        axY->setTitleText("Süre (µs)");
-        axY->setRange(0, maxY * 1.15);
+    // Tüm N değerleri aynı tohumla: N ürünlük küme, büyük kümenin ilk N ürünü
+    const WorkloadSpec workload = currentWorkload();
 
-        c->addAxis(axX, Qt::AlignBottom);
-        c->addAxis(axY, Qt::AlignLeft);
+    auto startRun = [=]() {
+        if (state->worker) return;
 
-        for (auto* s : c->series()) {
-            s->attachAxis(axX);
-            s->attachAxis(axY);
+        for (PerfChart& pc : state->charts) {
+            pc.series->clear();
+            pc.pending.clear();
+            if (pc.memSeries) pc.memSeries->clear();
+            pc.pendingMem.clear();
         }
+        state->maxY = 1.0;
+        state->maxMem = 1.0;
+
+        PerformanceWorker::Settings cfg;
+        cfg.maxN       = maxN;
+        cfg.shelfCount = shelfCount;
+        cfg.shelfCap   = shelfCap;
+        cfg.geometric  = chkGeometric->isChecked();
+        cfg.samples    = spSamples->value();
+        cfg.workload   = workload;
+        applyAxes(cfg.geometric);
+
+        auto* thread = new QThread();
+        auto* worker = new PerformanceWorker(cfg);
+        worker->moveToThread(thread);
+        state->thread = thread;
+        state->worker = worker;
+
+        connect(thread, &QThread::started, worker, &PerformanceWorker::run);
+        connect(worker, &PerformanceWorker::finished, thread, &QThread::quit, Qt::DirectConnection);
+        connect(thread, &QThread::finished, worker, &QObject::deleteLater);
+        connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+
+        connect(worker, &PerformanceWorker::pointReady, dlg,
+                [state](int n, double tS, double tG, double tD) {
+            state->charts[0].pending.append(QPointF(n, tS));
+            state->charts[1].pending.append(QPointF(n, tG));
+            state->charts[2].pending.append(QPointF(n, tD));
+            state->maxY = std::max({state->maxY, tS, tG, tD});
+        });
+        connect(worker, &PerformanceWorker::memoryReady, dlg,
+                [state](int n, double kS, double kG, double kD) {
+            state->charts[0].pendingMem.append(QPointF(n, kS));
+            state->charts[1].pendingMem.append(QPointF(n, kG));
+            state->charts[2].pendingMem.append(QPointF(n, kD));
+            state->maxMem = std::max({state->maxMem, kS, kG, kD});
+        });
+        connect(worker, &PerformanceWorker::progress, dlg, [bar](int done, int total) {
+            bar->setRange(0, total);
+            bar->setValue(done);
+        });
+        connect(worker, &PerformanceWorker::finished, dlg, [=](bool wasCancelled) {
+            flushTimer->stop();
+            flush();
+            state->thread = nullptr;
+            btnStart->setEnabled(true);
+            btnCancel->setEnabled(false);
+            chkGeometric->setEnabled(true);
+            spSamples->setEnabled(chkGeometric->isChecked());
+            bar->setFormat(wasCancelled ? "İptal edildi (%v/%m)" : "%p%");
+        });
+
+        btnStart->setEnabled(false);
+        btnCancel->setEnabled(true);
+        chkGeometric->setEnabled(false);
+        spSamples->setEnabled(false);
+        bar->setFormat("%v/%m");
+        bar->setRange(0, 1);
+        bar->setValue(0);
+
+        flushTimer->start();
+        thread->start();
     };
 
-    applyAxes(chartS);
-    applyAxes(chartG);
-    applyAxes(chartD);
+    connect(btnStart, &QPushButton::clicked, dlg, startRun);
+    connect(btnCancel, &QPushButton::clicked, dlg, [state]() {
+        if (state->worker) state->worker->cancel();
+    });
 
     // Close
     auto* btnClose = new QPushButton("Close");
     connect(btnClose, &QPushButton::clicked, dlg, &QDialog::accept);
     root->addWidget(btnClose, 0, Qt::AlignRight);
 
+    QTimer::singleShot(0, dlg, startRun);
     dlg->exec();
+
+    // Dialog kapandı: çalışan tarama varsa iptal et, mevcut ölçümün bitmesini bekle
+    if (state->worker) state->worker->cancel();
+    if (state->thread) {
+        state->thread->quit();
+        state->thread->wait();
+    }
+    delete dlg;
 }
@@ -1,34 +1,52 @@
 #pragma once
 
 #include <QMainWindow>
-#include <QTableWidget>
+#include <QTableView>
 #include <QTextEdit>
 #include <QLineEdit>
 #include <QSpinBox>
+#include <QDoubleSpinBox>
 #include <QPushButton>
 #include <QLabel>
 #include <QComboBox>
 #include <QMessageBox>
+#include <QPointer>
+#include <QThread>
+#include <atomic>
 
 #include "../model/Shelf.h"
+#include "../model/ShelfLayout.h"
 #include "../model/Product.h"
+#include "../model/ProductCatalog.h"
 #include "../algorithm/WarehouseAlgorithms.h"
+#include "../algorithm/PlacementCache.h"
+#include "ShelfTableModel.h"
 
 class MainWindow : public QMainWindow {
     Q_OBJECT
 
     public:
     explicit MainWindow(QWidget* parent = nullptr);
+    ~MainWindow() override;
 
     private slots:
         void regenerateProducts();
+    void openCatalog();
+    void saveCatalog();
     void runSearch();
     void runDepotEfficiency();
     void runStatic();
     void runGreedy();
+    void runBestFit();
     void runDP();
+    void runDPVolumeClasses();
+    void runDPParallel();
+    void runExact();
+    void runApprox();
     void runPerformance();
     void runAsciiMap();
+    void runLocalSearch();
+    void runStreamSimulation();
 
 private:
     // ================= UI =================
@@ -41,18 +59,36 @@ private:
     QSpinBox*    spProductCount = nullptr;
     QSpinBox*    spShelfCount = nullptr;
     QSpinBox*    spShelfCap = nullptr;
+    QSpinBox*    spSeed = nullptr;
+    QDoubleSpinBox* spEpsilon = nullptr;
+    QComboBox*   distCombo = nullptr;
     QPushButton* btnGenerate = nullptr;
+    QPushButton* btnOpenCatalog = nullptr;
+    QPushButton* btnSaveCatalog = nullptr;
 
-    QTableWidget* table = nullptr;
+    QTableView*      table = nullptr;
+    ShelfTableModel* shelfModel = nullptr;
     QTextEdit*    outText = nullptr;
 
     QPushButton* btnComplexity = nullptr;
     QPushButton* btnPerformance = nullptr;
     QPushButton* btnAscii = nullptr;
+    QPushButton* btnImprove = nullptr;
+    QSpinBox*    spImproveBudget = nullptr;
+    QPushButton* btnStream = nullptr;
 
     // ================= DATA =================
-    std::vector<Product> lastProducts;
-    std::vector<Shelf>   lastShelves;
+    ProductCatalog       catalog;
+    ShelfLayout          lastLayout;
+
+    // İsme göre sıralı görünüm (regenerateProducts'ta geçersiz olur)
+    NameIndex nameIndex;
+    bool hasNameIndex = false;
+
+    // İsim -> (katalog, raf, sıra); ilk aramada kurulur, sonra yerleşim
+    // üretildikçe güncellenir (büyük katalog açılışı isimleri dolaşmaz)
+    ProductLocationIndex locationIndex;
+    bool hasLocationIndex = false;
 
     // ================= SON ÇALIŞTIRILAN ALGORİTMA SONUÇLARI =================
     PlacementResult   lastStaticResult;
@@ -63,9 +99,28 @@ private:
     bool hasGreedy = false;
     bool hasDP = false;
 
+    // Aynı katalog + ayarlarla tekrar çalıştırma yeniden hesaplanmaz
+    PlacementCache placementCache;
+    uint64_t catalogFingerprint = 0;
+
+    // Arka planda süren kesin arama (bitince kendini siler)
+    QPointer<QThread> exactThread;
+    std::atomic<bool> exactCancel{false};
+
     // ================= HELPERS =================
-    void renderShelves(const std::vector<Shelf>& shelves);
+    // indexCurrent: konum indeksi bu yerleşimi zaten yansıtıyor (akış yolu)
+    void renderShelves(const ShelfLayout& layout, bool indexCurrent = false);
+    // Katalog değişti: parmak izi, indeksler ve önceki sonuçlar yenilenir
+    void catalogReplaced();
+    PlacementCacheKey cacheKey(PlacementAlgo algo, uint64_t param = 0) const;
+    PlacementResult  staticResult(bool* cached);
+    PlacementResult  greedyResult(bool* cached);
+    DPKnapsackResult dpResult(bool* cached);
+    void appendCacheNote(bool cached);
+    void ensureLocationIndex();
+    void showExactResult(const ExactPlacementResult& r, bool cached);
     void clearTableHighlights();
     void highlightProductInTable(const QString& name);
     void showStatus(const QString& msg);
+    WorkloadSpec currentWorkload() const;
 };
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "PerformanceWorker.h"
+#include "../algorithm/WarehouseAlgorithms.h"
+#include "../algorithm/AllocationTracker.h"
+
+#include <algorithm>
+#include <cmath>
+
+PerformanceWorker::PerformanceWorker(const Settings& settings, QObject* parent)
+    : QObject(parent), cfg(settings) {}
+
+std::vector<int> PerformanceWorker::sampleSizes(const Settings& settings) {
+    std::vector<int> sizes;
+    if (settings.maxN <= 0) return sizes;
+
+    if (!settings.geometric) {
+        sizes.reserve(settings.maxN);
+        for (int n = 1; n <= settings.maxN; ++n) sizes.push_back(n);
+        return sizes;
+    }
+
+    // 1 .. maxN arası logaritmik eşit aralıklı örnekler
+    const int k = std::max(2, settings.samples);
+    const double ratio = std::log((double)settings.maxN) / (k - 1);
+    for (int i = 0; i < k; ++i) {
+        int n = (int)std::lround(std::exp(ratio * i));
+        n = std::min(std::max(n, 1), settings.maxN);
+        if (sizes.empty() || sizes.back() != n) sizes.push_back(n);
+    }
+    if (sizes.back() != settings.maxN) sizes.push_back(settings.maxN);
+    return sizes;
+}
+
+void PerformanceWorker::run() {
+    const std::vector<int> sizes = sampleSizes(cfg);
+    const int total = (int)sizes.size();
+    const bool trackMemory = AllocationTracker::installed();
+
+    auto peakKB = [](const AllocationStats& st) { return st.peakLiveBytes / 1024.0; };
+
+    int done = 0;
+    for (int n : sizes) {
+        if (cancelled.load()) break;
+
+        auto products = WarehouseAlgorithms::generateProducts(n, cfg.workload);
+
+        // Süre ve bellek aynı çalıştırmadan ölçülür
+        ScopedAllocationTracking trackS;
+        auto rS = WarehouseAlgorithms::staticPlacement(products, cfg.shelfCount, cfg.shelfCap);
+        const AllocationStats mS = trackS.stop();
+
+        ScopedAllocationTracking trackG;
+        auto rG = WarehouseAlgorithms::greedyPlacement(products, cfg.shelfCount, cfg.shelfCap);
+        const AllocationStats mG = trackG.stop();
+        if (cancelled.load()) break;
+
+        ScopedAllocationTracking trackD;
+        auto rD = WarehouseAlgorithms::dpPlacementKnapsack(products, cfg.shelfCount, cfg.shelfCap);
+        const AllocationStats mD = trackD.stop();
+
+        emit pointReady(n, (double)rS.elapsedUs, (double)rG.elapsedUs, (double)rD.placement.elapsedUs);
+        if (trackMemory) emit memoryReady(n, peakKB(mS), peakKB(mG), peakKB(mD));
+        emit progress(++done, total);
+    }
+
+    emit finished(cancelled.load());
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <QObject>
+#include <atomic>
+#include <vector>
+
+#include "../algorithm/WorkloadGenerator.h"
+
+// Performans taramasını GUI dışındaki bir iş parçacığında çalıştırır.
+// Her N tamamlandıkça pointReady yayınlanır; cancel() iş parçacığı güvenlidir.
+class PerformanceWorker : public QObject {
+    Q_OBJECT
+
+public:
+    struct Settings {
+        int  maxN = 0;
+        int  shelfCount = 0;
+        int  shelfCap = 0;
+        bool geometric = false;   // true: N geometrik örneklenir
+        int  samples = 60;        // geometrik modda örnek sayısı
+        WorkloadSpec workload;    // her N için aynı tohum
+    };
+
+    explicit PerformanceWorker(const Settings& settings, QObject* parent = nullptr);
+
+    void cancel() { cancelled.store(true); }
+
+    // 1..maxN arası ölçülecek N değerleri (artan, tekrarsız)
+    static std::vector<int> sampleSizes(const Settings& settings);
+
+public slots:
+    void run();
+
+signals:
+    void pointReady(int n, double staticUs, double greedyUs, double dpUs);
+    // Tepe canlı bellek (KB); yalnızca ayırma kancaları bağlıysa yayınlanır
+    void memoryReady(int n, double staticPeakKB, double greedyPeakKB, double dpPeakKB);
+    void progress(int done, int total);
+    void finished(bool wasCancelled);
+
+private:
+    Settings cfg;
+    std::atomic<bool> cancelled{false};
+};
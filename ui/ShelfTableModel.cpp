@@ -0,0 +1,111 @@
+#include "ShelfTableModel.h"
+
+#include <QBrush>
+#include <QColor>
+
+ShelfTableModel::ShelfTableModel(QObject* parent)
+    : QAbstractTableModel(parent) {}
+
+void ShelfTableModel::setSource(const ShelfLayout* l, const ProductCatalog* c) {
+    beginResetModel();
+    layout = l;
+    catalog = c;
+    rows = (layout && catalog) ? layout->maxItemsPerShelf() : 0;
+    highlightRow = -1;
+    highlightCol = -1;
+    endResetModel();
+}
+
+void ShelfTableModel::setHighlight(int row, int column) {
+    const int oldRow = highlightRow;
+    const int oldCol = highlightCol;
+    highlightRow = row;
+    highlightCol = column;
+
+    if (oldRow >= 0 && oldCol >= 0) {
+        const QModelIndex i = index(oldRow, oldCol);
+        emit dataChanged(i, i, {Qt::BackgroundRole, Qt::ForegroundRole});
+    }
+    if (row >= 0 && column >= 0) {
+        const QModelIndex i = index(row, column);
+        emit dataChanged(i, i, {Qt::BackgroundRole, Qt::ForegroundRole});
+    }
+}
+
+int ShelfTableModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : rows;
+}
+
+int ShelfTableModel::columnCount(const QModelIndex& parent) const {
+    if (parent.isValid() || !layout || !catalog) return 0;
+    return layout->shelfCount();
+}
+
+int ShelfTableModel::itemAt(int row, int column) const {
+    if (row >= layout->itemCount(column)) return -1;
+    return layout->items[layout->offsets[column] + row];
+}
+
+double ShelfTableModel::fillRatio(int column) const {
+    const int cap = layout->capacity[column];
+    return (cap == 0) ? 0.0 : (double)layout->used[column] / cap;
+}
+
+// -------------------- data
+QVariant ShelfTableModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || !layout || !catalog) return QVariant();
+
+    const int idx = itemAt(index.row(), index.column());
+    if (idx < 0) return QVariant();
+
+    const bool highlighted = index.row() == highlightRow && index.column() == highlightCol;
+
+    switch (role) {
+        case Qt::DisplayRole:
+            return QString("%1\nS:%2 V:%3")
+                    .arg(catalog->name(idx).toString())
+                    .arg(catalog->sales(idx))
+                    .arg(catalog->volume(idx));
+
+        case Qt::BackgroundRole: {
+            if (highlighted) return QBrush(QColor(255, 235, 59));
+            const double ratio = fillRatio(index.column());
+            if (ratio < 0.5) return QBrush(QColor(200, 255, 200));
+            if (ratio < 0.8) return QBrush(QColor(255, 240, 180));
+            return QBrush(QColor(255, 200, 200));
+        }
+
+        case Qt::ForegroundRole:
+            if (highlighted) return QBrush(Qt::black);
+            return QVariant();
+
+        default:
+            return QVariant();
+    }
+}
+
+QVariant ShelfTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+    if (orientation != Qt::Horizontal || !layout || !catalog)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    switch (role) {
+        case Qt::DisplayRole:
+            return QString("Raf %1 (K:%2 U:%3)")
+                    .arg(section + 1)
+                    .arg(layout->capacity[section])
+                    .arg(layout->used[section]);
+
+        case Qt::BackgroundRole: {
+            const double ratio = fillRatio(section);
+            if (ratio < 0.5) return QBrush(QColor(150, 220, 150));
+            if (ratio < 0.8) return QBrush(QColor(230, 210, 140));
+            return QBrush(QColor(230, 160, 160));
+        }
+
+        case Qt::ForegroundRole:
+            return QBrush(Qt::black);
+
+        default:
+            return QVariant();
+    }
+}
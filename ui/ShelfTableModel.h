@@ -0,0 +1,41 @@
+#pragma once
+
+#include <QAbstractTableModel>
+
+#include "../model/ShelfLayout.h"
+#include "../model/ProductCatalog.h"
+
+// Yerleşimi doğrudan gösteren sanal tablo: sütun = raf, satır = raf içi sıra.
+// Hücre metni ve renkleri data() içinde, yalnızca görünen hücreler için üretilir.
+// Yerleşim ve katalog MainWindow'a aittir; model yalnızca işaretçi tutar.
+class ShelfTableModel : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    explicit ShelfTableModel(QObject* parent = nullptr);
+
+    // O(raf): satır sayısı için raf başına ürün sayısının en büyüğü bulunur.
+    // layout == nullptr tabloyu boşaltır.
+    void setSource(const ShelfLayout* layout, const ProductCatalog* catalog);
+
+    // Tek hücre sarı işaretlenir; önceki işaret kalkar
+    void setHighlight(int row, int column);
+    void clearHighlight() { setHighlight(-1, -1); }
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+private:
+    // Hücredeki katalog indeksi; boş hücrede -1
+    int itemAt(int row, int column) const;
+    double fillRatio(int column) const;
+
+    const ShelfLayout* layout = nullptr;
+    const ProductCatalog* catalog = nullptr;
+    int rows = 0;
+
+    int highlightRow = -1;
+    int highlightCol = -1;
+};